@@ -4,13 +4,42 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <list>
 #include <queue>
+#include <deque>
 #include <stack>
 #include <set>
 #include <algorithm>
 #include <limits>
 #include <iomanip>
 #include <cmath>
+#include <memory>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <string_view>
+#include <chrono>
+#include <thread>
+#include <filesystem>
+#include <random>
+#include <functional>
+#include <mutex>
+#include <future>
+#include <atomic>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 // Define M_PI if not defined
 #ifndef M_PI
@@ -44,11 +73,114 @@ struct Route {
         : destination(dest), distance(dist), airline(air) {}
 };
 
+// ==================== AIRPORT ID (PACKED IATA CODE) ====================
+
+// Jumlah kemungkinan kode 3 karakter base-36 (0-9, A-Z)
+const int AIRPORT_ID_SPACE = 36 * 36 * 36;
+
+/**
+ * AirportId - Kode IATA 3 karakter yang dipack menjadi integer 16-bit
+ * Karakter 0-9 -> 0..9 dan A-Z -> 10..35 (base-36), sehingga urutan numerik
+ * sama dengan urutan leksikografis kode. Parsing dilakukan sekali di batas API,
+ * setelah itu lookup ke vertex ID cukup dengan direct-index table.
+ */
+struct AirportId {
+    uint16_t value;
+    
+    static const uint16_t INVALID = 0xFFFF;
+    
+    AirportId() : value(INVALID) {}
+    explicit AirportId(uint16_t v) : value(v) {}
+    
+    // Parse kode IATA ("CGK"), return AirportId invalid jika bukan 3 karakter A-Z/0-9
+    static AirportId fromCode(string_view code) {
+        if (code.length() != 3) {
+            return AirportId();
+        }
+        
+        int packed = 0;
+        for (char c : code) {
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'A' && c <= 'Z') {
+                digit = c - 'A' + 10;
+            } else {
+                return AirportId();
+            }
+            packed = packed * 36 + digit;
+        }
+        return AirportId((uint16_t)packed);
+    }
+    
+    string toCode() const {
+        if (!isValid()) {
+            return "???";
+        }
+        
+        string code(3, ' ');
+        int packed = value;
+        for (int i = 2; i >= 0; i--) {
+            int digit = packed % 36;
+            code[i] = digit < 10 ? (char)('0' + digit) : (char)('A' + digit - 10);
+            packed /= 36;
+        }
+        return code;
+    }
+    
+    bool isValid() const { return value < AIRPORT_ID_SPACE; }
+    
+    bool operator==(const AirportId& other) const { return value == other.value; }
+    bool operator!=(const AirportId& other) const { return value != other.value; }
+    bool operator<(const AirportId& other) const { return value < other.value; }
+};
+
+// Rute yang masuk ke sebuah bandara (hasil getIncoming)
+struct IncomingRoute {
+    string origin;
+    int distance;
+    string airline;
+    
+    IncomingRoute(string orig, int dist, string air)
+        : origin(orig), distance(dist), airline(air) {}
+};
+
+// Rute pada penyimpanan internal: semua field integer (tanpa string per edge)
+struct RouteRecord {
+    int target;     // Vertex ID tujuan
+    int distance;   // Jarak dalam km
+    int airline;    // Index ke tabel nama maskapai
+    
+    RouteRecord(int t, int d, int a) : target(t), distance(d), airline(a) {}
+};
+
+// Edge mentah untuk bulk build (vertex ID + airline ID)
+struct RouteEdge {
+    int from;
+    int to;
+    int distance;
+    int airline;
+};
+
+// Edge input untuk addEdgesBulk (API publik)
+struct BulkEdge {
+    AirportId from;
+    AirportId to;
+    int distance;
+    string airline;
+};
+
+// Kebijakan deduplikasi untuk bulk build
+enum class DuplicatePolicy {
+    KEEP_ALL_AIRLINES,   // Satu rute per (from, to, airline): semua maskapai tetap disimpan
+    ONE_EDGE_PER_PAIR    // Satu rute per (from, to) dengan jarak minimum (khusus pathfinding)
+};
+
 struct NodeDistance {
-    string airport;
+    int vertex;     // Vertex ID (bukan string, agar push/pop tidak meng-copy string)
     int distance;
     
-    NodeDistance(string a, int d) : airport(a), distance(d) {}
+    NodeDistance(int v, int d) : vertex(v), distance(d) {}
     
     bool operator>(const NodeDistance& other) const {
         return distance > other.distance;
@@ -72,417 +204,4734 @@ struct PathResult {
     int totalDistance;
     string algorithm;
     bool found;
+    int expandedNodes;  // Jumlah node yang di-settle / di-expand (untuk benchmark)
     
-    PathResult() : stops(0), totalDistance(0), algorithm(""), found(false) {}
+    PathResult() : stops(0), totalDistance(0), algorithm(""), found(false), expandedNodes(0) {}
 };
 
-// ==================== FORWARD DECLARATIONS ====================
-double calculateDistance(double lat1, double lon1, double lat2, double lon2);
-vector<string> parseCSVLine(const string& line);
-string toUpperCase(string str);
-string trim(const string& str);
-bool isValidAirportCode(const string& code);
+// Algoritma pencarian path (batch query dan kunci cache hasil)
+enum class QueryAlgorithm {
+    DIJKSTRA,
+    BFS,
+    DFS,
+    BIDIRECTIONAL,
+    ASTAR,
+    ALT,
+    CH,
+    MAX_STOPS      // Hanya kunci cache findShortestPathWithMaxStops (bukan algoritma batch)
+};
 
-// ==================== CLASS FLIGHT ROUTE GRAPH ====================
+// Callback enumerasi path: dipanggil per path (kode bandara), return false untuk berhenti
+using PathCallback = function<bool(const vector<string>& path)>;
 
-class FlightRouteGraph {
-private:
-    unordered_map<string, vector<Route>> adjacencyList;
-    unordered_map<string, Airport> vertexMap;
+// Batas opsional enumerasi findAllPaths (0 = tanpa batas)
+struct PathEnumerationLimits {
+    size_t maxResults;
+    double timeBudgetMillis;
     
-    vector<string> reconstructPath(const unordered_map<string, string>& parent, 
-                                   const string& start, const string& end) {
-        vector<string> path;
-        string current = end;
-        
-        while (current != start) {
-            path.push_back(current);
-            if (parent.find(current) == parent.end()) {
-                return vector<string>();
-            }
-            current = parent.at(current);
+    PathEnumerationLimits(size_t results = 0, double millis = 0)
+        : maxResults(results), timeBudgetMillis(millis) {}
+};
+
+// Statistik hasil enumerasi findAllPaths
+struct PathEnumerationStats {
+    size_t pathsFound;
+    size_t nodesExpanded;
+    bool truncated;   // Berhenti karena maxResults / callback
+    bool timedOut;    // Berhenti karena timeBudgetMillis
+    double millis;
+    
+    PathEnumerationStats() : pathsFound(0), nodesExpanded(0), truncated(false), timedOut(false), millis(0) {}
+};
+
+// State satu DFS enumerasi: path aktif, penanda vertex di path, dan deadline
+struct PathEnumerationState {
+    vector<int> path;
+    vector<char> visited;
+    size_t nodesExpanded;
+    bool timedOut;
+    bool hasDeadline;
+    chrono::steady_clock::time_point deadline;
+    const atomic<bool>* cancelled;   // Flag stop bersama (enumerasi paralel), boleh nullptr
+    
+    PathEnumerationState(int n, double timeBudgetMillis,
+                         chrono::steady_clock::time_point startTime = chrono::steady_clock::now())
+        : visited(n, 0), nodesExpanded(0), timedOut(false), hasDeadline(timeBudgetMillis > 0), cancelled(nullptr) {
+        if (hasDeadline) {
+            deadline = startTime + chrono::duration_cast<chrono::steady_clock::duration>(
+                                       chrono::duration<double, milli>(timeBudgetMillis));
         }
-        path.push_back(start);
-        reverse(path.begin(), path.end());
-        
-        return path;
     }
     
-    // Hitung total jarak dari path
-    int calculatePathDistance(const vector<string>& path) {
-        if (path.size() < 2) return 0;
-        
-        int totalDistance = 0;
-        for (size_t i = 0; i < path.size() - 1; i++) {
-            string from = path[i];
-            string to = path[i + 1];
-            
-            for (const Route& route : adjacencyList[from]) {
-                if (route.destination == to) {
-                    totalDistance += route.distance;
-                    break;
-                }
-            }
+    // true jika DFS harus berhenti: deadline lewat (set timedOut) atau dibatalkan dari luar
+    bool shouldStop() {
+        if (hasDeadline && chrono::steady_clock::now() >= deadline) {
+            timedOut = true;
         }
-        return totalDistance;
+        return timedOut || (cancelled != nullptr && cancelled->load(memory_order_relaxed));
     }
+};
+
+// Task enumerasi paralel: prefix path hasil split di 1-2 hop pertama
+struct PathTask {
+    vector<int> prefix;
+};
+
+/**
+ * PathTaskPool - Deque task per worker dengan work stealing
+ * Worker mengambil dari belakang deque miliknya; jika kosong, mencuri dari depan
+ * deque worker lain sehingga worker yang selesai duluan membantu subtree yang besar.
+ */
+class PathTaskPool {
+private:
+    struct WorkerQueue {
+        mutex lock;
+        deque<PathTask> tasks;
+    };
+    vector<unique_ptr<WorkerQueue>> queues;
 
 public:
-    // ==================== FUNGSI DASAR GRAPH ====================
-    
-    void addVertex(const string& airportCode, const string& airportName, int airportID,
-                   const string& city = "", const string& country = "", 
-                   double latitude = 0, double longitude = 0) {
-        if (vertexMap.find(airportCode) != vertexMap.end()) {
-            return;
+    explicit PathTaskPool(int workers) {
+        for (int i = 0; i < workers; i++) {
+            queues.emplace_back(new WorkerQueue());
         }
-        
-        vertexMap[airportCode] = Airport(airportCode, airportName, airportID, city, country, latitude, longitude);
-        adjacencyList[airportCode] = vector<Route>();
     }
     
-    void addEdge(const string& from, const string& to, int distance, const string& airline) {
-        if (vertexMap.find(from) == vertexMap.end()) {
-            cerr << "Error: Bandara asal '" << from << "' tidak ditemukan!" << endl;
-            return;
+    void push(int worker, PathTask task) {
+        WorkerQueue& queue = *queues[worker];
+        lock_guard<mutex> guard(queue.lock);
+        queue.tasks.push_back(move(task));
+    }
+    
+    bool pop(int worker, PathTask& task) {
+        {
+            WorkerQueue& own = *queues[worker];
+            lock_guard<mutex> guard(own.lock);
+            if (!own.tasks.empty()) {
+                task = move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
         }
-        if (vertexMap.find(to) == vertexMap.end()) {
-            cerr << "Error: Bandara tujuan '" << to << "' tidak ditemukan!" << endl;
-            return;
+        for (size_t i = 1; i < queues.size(); i++) {
+            WorkerQueue& victim = *queues[(worker + i) % queues.size()];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
         }
-        
-        // Check untuk duplicate route (from->to) dengan jarak yang sama
-        // Kita tetap simpan jika maskapai berbeda untuk displayNeighbors
-        // Tapi untuk pathfinding, kita hanya perlu satu edge per (from, to) pair
-        bool routeExists = false;
-        for (const Route& r : adjacencyList[from]) {
-            if (r.destination == to && r.distance == distance) {
-                routeExists = true;
+        return false;
+    }
+};
+
+/**
+ * PathSink - Penampung hasil enumerasi paralel yang thread-safe
+ * Worker mengirim path per batch; callback dipanggil serial di bawah lock sehingga
+ * callback tidak perlu thread-safe. Batas maxResults dihitung global lintas worker.
+ */
+class PathSink {
+private:
+    mutex lock;
+    const PathCallback& onPath;
+    size_t maxResults;
+    size_t delivered;
+    bool truncated;
+    atomic<bool> stopped;
+
+public:
+    PathSink(const PathCallback& callback, size_t limit)
+        : onPath(callback), maxResults(limit), delivered(0), truncated(false), stopped(false) {}
+    
+    // Kirim batch ke callback, return false jika enumerasi harus berhenti
+    bool deliver(const vector<vector<string>>& batch) {
+        lock_guard<mutex> guard(lock);
+        for (const vector<string>& path : batch) {
+            if (stopped) {
                 break;
             }
+            delivered++;
+            if (!onPath(path) || (maxResults > 0 && delivered >= maxResults)) {
+                truncated = true;
+                stopped = true;
+            }
         }
-        
-        // Untuk pathfinding, simpan hanya satu route per destination
-        // Tapi simpan semua untuk displayNeighbors
-        adjacencyList[from].push_back(Route(to, distance, airline));
+        return !stopped;
     }
     
-    // ==================== FUNGSI BARU: GRAPH OPERATIONS ====================
+    void cancel() { stopped = true; }
+    const atomic<bool>& stopFlag() const { return stopped; }
+    size_t count() const { return delivered; }
+    bool wasTruncated() const { return truncated; }
+};
+
+// ==================== CSR GRAPH CORE ====================
+
+/**
+ * CSRGraph - Representasi Compressed Sparse Row yang immutable untuk pathfinding
+ *
+ * Setiap bandara memiliki vertex ID integer dense (0..V-1). Edge yang keluar
+ * dari vertex v berada di targets/weights pada range [offsets[v], offsets[v+1]).
+ * Hanya ada satu edge per pasangan (from, to) dengan jarak minimum, diurutkan
+ * berdasarkan kode IATA tujuan (urutan yang sama dengan set<string> versi lama).
+ * Edge masuk (reverse CSR) disimpan dengan format yang sama di inOffsets/inSources/inWeights,
+ * untuk pencarian mundur dari bandara tujuan.
+ * Posisi bandara disimpan sebagai vektor satuan 3D (unitX/Y/Z) untuk heuristic A*:
+ * jarak great-circle = 2R * asin(|p - q| / 2), tanpa trigonometri per query.
+ * heuristicScale adalah min(weight / jarak great-circle) atas semua edge.
+ * Array bisa milik sendiri (hasil rebuildCSR) atau view langsung ke file snapshot (loadSnapshot).
+ */
+
+/**
+ * CSRArray - Array read-only untuk CSRGraph: buffer milik sendiri atau view ke memori lain
+ * View dipakai untuk snapshot yang di-mmap: array menunjuk langsung ke region file dan
+ * ikut memegang pemilik memorinya (shared_ptr) sampai CSR terakhir yang memakainya dilepas.
+ */
+template <typename T>
+class CSRArray {
+private:
+    vector<T> owned;
+    const T* items;
+    size_t count;
+    shared_ptr<const void> owner;   // Pemilik memori view, nullptr jika buffer milik sendiri
+
+public:
+    CSRArray() : items(nullptr), count(0) {}
     
-    /**
-     * removeEdge - Menghapus edge (rute) dari graph
-     * @param from: Bandara asal
-     * @param to: Bandara tujuan
-     * @return: true jika berhasil dihapus, false jika tidak ditemukan
-     */
-    bool removeEdge(const string& from, const string& to) {
-        // Check apakah vertex exist
-        if (vertexMap.find(from) == vertexMap.end()) {
-            cerr << "Error: Bandara asal '" << from << "' tidak ditemukan!" << endl;
-            return false;
-        }
-        if (vertexMap.find(to) == vertexMap.end()) {
-            cerr << "Error: Bandara tujuan '" << to << "' tidak ditemukan!" << endl;
-            return false;
+    CSRArray(const CSRArray& other) : items(nullptr), count(0) {
+        *this = other;
+    }
+    
+    CSRArray& operator=(const CSRArray& other) {
+        if (this != &other) {
+            owned = other.owned;
+            owner = other.owner;
+            items = owner ? other.items : owned.data();
+            count = other.count;
         }
-        
-        // Cari dan hapus edge
-        auto& routes = adjacencyList[from];
-        bool found = false;
-        
-        for (auto it = routes.begin(); it != routes.end(); ) {
-            if (it->destination == to) {
-                it = routes.erase(it);
-                found = true;
-                // Tidak break karena bisa ada multiple routes dengan airline berbeda
-            } else {
-                ++it;
+        return *this;
+    }
+    
+    void assign(vector<T>&& values) {
+        owned = move(values);
+        owner.reset();
+        items = owned.data();
+        count = owned.size();
+    }
+    
+    void view(const T* data, size_t size, shared_ptr<const void> memoryOwner) {
+        vector<T>().swap(owned);
+        owner = move(memoryOwner);
+        items = data;
+        count = size;
+    }
+    
+    const T& operator[](size_t i) const { return items[i]; }
+    const T* data() const { return items; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + count; }
+};
+
+struct CSRGraph {
+    CSRArray<int> offsets;   // Ukuran V+1
+    CSRArray<int> targets;   // Vertex ID tujuan, ukuran E
+    CSRArray<int> weights;   // Jarak (km), ukuran E
+    
+    CSRArray<int> inOffsets; // Ukuran V+1
+    CSRArray<int> inSources; // Vertex ID asal, ukuran E
+    CSRArray<int> inWeights; // Jarak (km), ukuran E
+    
+    CSRArray<double> unitX, unitY, unitZ;  // Vektor satuan posisi bandara, ukuran V
+    double heuristicScale; // Faktor heuristic A* (0 = heuristic dimatikan)
+    int maxWeight;         // Bobot edge terbesar (ukuran ring bucket Dial)
+    
+    CSRGraph() : heuristicScale(0), maxWeight(0) {}
+    
+    int numVertices() const { return offsets.empty() ? 0 : (int)offsets.size() - 1; }
+    int numEdges() const { return (int)targets.size(); }
+    int edgeBegin(int v) const { return offsets[v]; }
+    int edgeEnd(int v) const { return offsets[v + 1]; }
+    int inEdgeBegin(int v) const { return inOffsets[v]; }
+    int inEdgeEnd(int v) const { return inOffsets[v + 1]; }
+    
+    // Cari edge (from -> to), return index edge atau -1
+    int findEdge(int from, int to) const {
+        for (int e = edgeBegin(from); e < edgeEnd(from); e++) {
+            if (targets[e] == to) {
+                return e;
             }
         }
-        
-        if (!found) {
-            cerr << "Warning: Rute " << from << " → " << to << " tidak ditemukan!" << endl;
-        }
-        
-        return found;
+        return -1;
     }
     
-    /**
-     * hasVertex - Mengecek apakah vertex (bandara) ada dalam graph
-     * @param airportCode: Kode bandara (contoh: "CGK")
-     * @return: true jika ada, false jika tidak
-     */
-    bool hasVertex(const string& airportCode) const {
-        return vertexMap.find(airportCode) != vertexMap.end();
+    // Jarak great-circle (km) antara dua vertex dari vektor satuan
+    double greatCircle(int a, int b) const {
+        double dx = unitX[a] - unitX[b];
+        double dy = unitY[a] - unitY[b];
+        double dz = unitZ[a] - unitZ[b];
+        double halfChord = sqrt(dx * dx + dy * dy + dz * dz) / 2;
+        return 2 * 6371.0 * asin(min(1.0, halfChord));
     }
+};
+
+// ==================== SEARCH WORKSPACE ====================
+
+/**
+ * SearchLabels - Label per vertex (jarak, parent) untuk satu arah pencarian
+ * Array dense diindeks vertex ID. Reset O(1) dengan epoch: label vertex v hanya
+ * valid jika stamp[v] == epoch, sehingga tidak perlu mengisi ulang array setiap query.
+ */
+struct SearchLabels {
+    vector<uint32_t> stamp;
+    vector<int> dist;
+    vector<int> parent;
+    vector<int> extra;     // Data tambahan per vertex (cache heuristic A*)
+    uint32_t epoch;
     
-    /**
-     * hasEdge - Mengecek apakah edge (rute) ada dalam graph
-     * @param from: Bandara asal
-     * @param to: Bandara tujuan
-     * @return: true jika rute exist, false jika tidak
-     */
-    bool hasEdge(const string& from, const string& to) const {
-        // Check apakah vertex exist
-        if (vertexMap.find(from) == vertexMap.end()) {
-            return false;
+    SearchLabels() : epoch(0) {}
+    
+    void reset(int n) {
+        if ((int)stamp.size() < n) {
+            stamp.resize(n, 0);
+            dist.resize(n);
+            parent.resize(n);
+            extra.resize(n);
         }
-        
-        // Check apakah edge exist
-        auto it = adjacencyList.find(from);
-        if (it == adjacencyList.end()) {
-            return false;
+        if (++epoch == 0) {
+            // Epoch overflow (setelah 2^32 reset): bersihkan stamp sekali
+            fill(stamp.begin(), stamp.end(), 0);
+            epoch = 1;
         }
-        
-        const vector<Route>& routes = it->second;
-        for (const Route& route : routes) {
-            if (route.destination == to) {
-                return true;
+    }
+    
+    bool reached(int v) const { return stamp[v] == epoch; }
+    int distance(int v) const { return reached(v) ? dist[v] : numeric_limits<int>::max(); }
+    
+    void set(int v, int d, int p) {
+        stamp[v] = epoch;
+        dist[v] = d;
+        parent[v] = p;
+    }
+};
+
+/**
+ * NodeHeap - Min-heap NodeDistance di atas vector yang dipakai ulang
+ * Urutan pop sama dengan priority_queue<..., greater<NodeDistance>>, tapi kapasitas
+ * vector tetap tersimpan di antara query (tanpa alokasi setelah warm-up).
+ */
+struct NodeHeap {
+    vector<NodeDistance> items;
+    
+    static const char* name() { return "Binary heap"; }
+    
+    bool empty() const { return items.empty(); }
+    const NodeDistance& top() const { return items.front(); }
+    void clear() { items.clear(); }
+    void reset(int, int) { clear(); }
+    
+    void push(const NodeDistance& node) {
+        items.push_back(node);
+        push_heap(items.begin(), items.end(), greater<NodeDistance>());
+    }
+    
+    void push(int v, int d) { push(NodeDistance(v, d)); }
+    
+    void pop() {
+        pop_heap(items.begin(), items.end(), greater<NodeDistance>());
+        items.pop_back();
+    }
+    
+    NodeDistance popMin() {
+        NodeDistance node = top();
+        pop();
+        return node;
+    }
+};
+
+// ==================== PRIORITY QUEUE POLICY (DIJKSTRA) ====================
+//
+// Policy queue untuk dijkstraSearch: reset(n, maxWeight), push(v, d), empty(), popMin().
+// push pada vertex yang sudah ada di queue berarti decrease-key. Policy "lazy"
+// (NodeHeap, RadixHeapQueue, DialQueue) menyimpan entry duplikat dan boleh mengembalikan
+// entry basi dari popMin; Dijkstra melewatinya dengan cek jarak label.
+// RadixHeapQueue dan DialQueue hanya valid untuk Dijkstra (kunci pop monoton naik).
+
+// Index bit 1 tertinggi (word tidak boleh 0)
+inline int highestBitIndex(uint32_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse(&index, word);
+    return (int)index;
+#else
+    return 31 - __builtin_clz(word);
+#endif
+}
+
+/**
+ * RadixHeapQueue - Radix heap monoton untuk kunci integer (km)
+ * Bucket i berisi entry yang kuncinya berbeda dari kunci pop terakhir mulai bit ke-(i-1).
+ * Saat bucket 0 kosong, bucket terkecil yang terisi didistribusikan ulang relatif terhadap
+ * kunci minimumnya; setiap entry berpindah paling banyak 32 kali (amortized O(log C)).
+ */
+struct RadixHeapQueue {
+    vector<NodeDistance> buckets[33];
+    uint32_t last;
+    size_t count;
+    
+    RadixHeapQueue() : last(0), count(0) {}
+    
+    static const char* name() { return "Radix heap"; }
+    
+    bool empty() const { return count == 0; }
+    
+    void reset(int, int) {
+        if (count > 0) {
+            for (vector<NodeDistance>& bucket : buckets) {
+                bucket.clear();
             }
         }
-        
-        return false;
+        last = 0;
+        count = 0;
     }
     
-    /**
-     * indegree - Menghitung jumlah edge yang MASUK ke vertex
-     * @param airportCode: Kode bandara
-     * @return: Jumlah rute yang menuju ke bandara ini
-     */
-    int indegree(const string& airportCode) const {
-        // Check apakah vertex exist
-        if (vertexMap.find(airportCode) == vertexMap.end()) {
-            cerr << "Error: Bandara '" << airportCode << "' tidak ditemukan!" << endl;
-            return -1;
+    int bucketIndex(uint32_t key) const {
+        return key == last ? 0 : highestBitIndex(key ^ last) + 1;
+    }
+    
+    void push(int v, int d) {
+        buckets[bucketIndex(d)].push_back(NodeDistance(v, d));
+        count++;
+    }
+    
+    NodeDistance popMin() {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) {
+                i++;
+            }
+            uint32_t minKey = numeric_limits<uint32_t>::max();
+            for (const NodeDistance& node : buckets[i]) {
+                minKey = min(minKey, (uint32_t)node.distance);
+            }
+            last = minKey;
+            for (const NodeDistance& node : buckets[i]) {
+                buckets[bucketIndex(node.distance)].push_back(node);
+            }
+            buckets[i].clear();
         }
-        
-        int count = 0;
-        
-        // Iterasi semua vertices
-        for (const auto& pair : adjacencyList) {
-            const string& from = pair.first;
-            const vector<Route>& routes = pair.second;
-            
-            // Count routes yang menuju ke airportCode
-            for (const Route& route : routes) {
-                if (route.destination == airportCode) {
-                    count++;
-                }
+        NodeDistance node = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return node;
+    }
+};
+
+/**
+ * DialQueue - Bucket queue Dial dengan ring maxWeight + 1 bucket
+ * Semua entry di queue berjarak [current, current + maxWeight], jadi satu ring cukup.
+ * popMin memajukan current sampai bucket terisi: O(1) amortized per km jarak.
+ */
+struct DialQueue {
+    vector<vector<NodeDistance>> ring;
+    vector<int> usedBuckets;   // Bucket yang pernah terisi sejak reset (untuk clear murah)
+    int current;
+    size_t count;
+    
+    DialQueue() : current(0), count(0) {}
+    
+    static const char* name() { return "Dial buckets"; }
+    
+    bool empty() const { return count == 0; }
+    
+    void reset(int, int maxWeight) {
+        if ((int)ring.size() != maxWeight + 1) {
+            ring.assign(maxWeight + 1, vector<NodeDistance>());
+        } else {
+            for (int b : usedBuckets) {
+                ring[b].clear();
             }
         }
-        
-        return count;
+        usedBuckets.clear();
+        current = 0;
+        count = 0;
     }
     
-    /**
-     * outdegree - Menghitung jumlah edge yang KELUAR dari vertex
-     * @param airportCode: Kode bandara
-     * @return: Jumlah rute yang berangkat dari bandara ini
-     */
-    int outdegree(const string& airportCode) const {
-        // Check apakah vertex exist
-        if (vertexMap.find(airportCode) == vertexMap.end()) {
-            cerr << "Error: Bandara '" << airportCode << "' tidak ditemukan!" << endl;
-            return -1;
+    void push(int v, int d) {
+        vector<NodeDistance>& bucket = ring[d % ring.size()];
+        if (bucket.empty()) {
+            usedBuckets.push_back(d % ring.size());
         }
-        
-        // Return jumlah routes dari bandara ini
-        auto it = adjacencyList.find(airportCode);
-        if (it == adjacencyList.end()) {
-            return 0;
+        bucket.push_back(NodeDistance(v, d));
+        count++;
+    }
+    
+    NodeDistance popMin() {
+        while (ring[current % ring.size()].empty()) {
+            current++;
         }
-        
-        return it->second.size();
+        vector<NodeDistance>& bucket = ring[current % ring.size()];
+        NodeDistance node = bucket.back();
+        bucket.pop_back();
+        count--;
+        return node;
     }
+};
+
+/**
+ * QuaternaryHeapQueue - 4-ary min-heap terindeks dengan decrease-key
+ * position[v] = indeks v di heap (-1 jika tidak ada), jadi setiap vertex paling banyak
+ * satu entry dan popMin tidak pernah mengembalikan entry basi.
+ */
+struct QuaternaryHeapQueue {
+    vector<NodeDistance> heap;
+    vector<int> position;
     
-    // ==================== END FUNGSI BARU ====================
+    static const char* name() { return "4-ary indexed heap"; }
     
-    vector<Route> getNeighbors(const string& airportCode) {
-        if (adjacencyList.find(airportCode) != adjacencyList.end()) {
-            return adjacencyList[airportCode];
+    bool empty() const { return heap.empty(); }
+    
+    void reset(int n, int) {
+        for (const NodeDistance& node : heap) {
+            position[node.vertex] = -1;
+        }
+        heap.clear();
+        if ((int)position.size() < n) {
+            position.resize(n, -1);
         }
-        return vector<Route>();
     }
     
-    // ==================== BFS - DENGAN RETURN PATHRESULT ====================
-    PathResult findPathBFS(const string& start, const string& end) {
-        PathResult result;
-        result.algorithm = "BFS (Breadth-First Search)";
-        
-        if (vertexMap.find(start) == vertexMap.end() || 
-            vertexMap.find(end) == vertexMap.end()) {
-            result.found = false;
-            return result;
+    void push(int v, int d) {
+        int i = position[v];
+        if (i == -1) {
+            i = heap.size();
+            heap.push_back(NodeDistance(v, d));
+        } else if (d < heap[i].distance) {
+            heap[i].distance = d;
+        } else {
+            return;
         }
-        
-        unordered_map<string, string> parent;
-        unordered_map<string, bool> visited;
-        queue<string> q;
-        
-        q.push(start);
-        visited[start] = true;
-        
-        while (!q.empty()) {
-            string current = q.front();
-            q.pop();
-            
-            if (current == end) {
-                result.path = reconstructPath(parent, start, end);
-                result.stops = result.path.size() - 1;
-                result.totalDistance = calculatePathDistance(result.path);
-                result.found = true;
+        siftUp(i);
+    }
+    
+    NodeDistance popMin() {
+        NodeDistance node = heap[0];
+        position[node.vertex] = -1;
+        NodeDistance lastNode = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = lastNode;
+            position[lastNode.vertex] = 0;
+            siftDown(0);
+        }
+        return node;
+    }
+
+private:
+    void siftUp(int i) {
+        NodeDistance node = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / 4;
+            if (heap[parent].distance <= node.distance) {
+                break;
+            }
+            heap[i] = heap[parent];
+            position[heap[i].vertex] = i;
+            i = parent;
+        }
+        heap[i] = node;
+        position[node.vertex] = i;
+    }
+    
+    void siftDown(int i) {
+        NodeDistance node = heap[i];
+        int size = heap.size();
+        while (true) {
+            int first = 4 * i + 1;
+            if (first >= size) {
+                break;
+            }
+            int best = first;
+            int end = min(first + 4, size);
+            for (int c = first + 1; c < end; c++) {
+                if (heap[c].distance < heap[best].distance) {
+                    best = c;
+                }
+            }
+            if (heap[best].distance >= node.distance) {
+                break;
+            }
+            heap[i] = heap[best];
+            position[heap[i].vertex] = i;
+            i = best;
+        }
+        heap[i] = node;
+        position[node.vertex] = i;
+    }
+};
+
+/**
+ * SearchWorkspace - Scratch memory untuk satu pencarian (maju + mundur)
+ * Bisa diberikan ke setiap fungsi pencarian; jika tidak, dipakai workspace thread_local
+ * milik thread pemanggil. Satu workspace hanya boleh dipakai satu pencarian pada satu waktu.
+ */
+// Perbaikan jarak satu vertex di satu layer hop (rekonstruksi path max stops)
+struct HopRecord {
+    int layer;
+    int parent;
+    int previous;   // Record sebelumnya untuk vertex yang sama, -1 jika tidak ada
+};
+
+struct SearchWorkspace {
+    SearchLabels forward, backward;
+    NodeHeap heapForward, heapBackward;
+    vector<int> frontier;  // Queue BFS / stack DFS
+    vector<int> layerDist;               // Dua layer jarak bergantian (max stops), ukuran 2 * n
+    vector<int> hopHead;                 // Vertex -> HopRecord terbaru, -1 jika belum pernah membaik
+    vector<HopRecord> hopRecords;
+    vector<pair<int64_t, int>> keyedHeap;  // Heap kunci (jarak, stops) untuk distance matrix
+    
+    void prepare(int n) {
+        forward.reset(n);
+        backward.reset(n);
+        heapForward.clear();
+        heapBackward.clear();
+        frontier.clear();
+        keyedHeap.clear();
+    }
+};
+
+// Workspace default per thread
+SearchWorkspace& threadWorkspace() {
+    thread_local SearchWorkspace workspace;
+    return workspace;
+}
+
+/**
+ * dijkstraSearch - Inti Dijkstra dengan policy priority queue sebagai parameter template
+ * Entry basi dari policy lazy dilewati dengan membandingkan jarak label.
+ * @param t: Vertex tujuan (berhenti saat di-settle), -1 = one-to-all
+ * @return: Jumlah node yang di-settle
+ */
+template <typename Queue>
+int dijkstraSearch(const CSRGraph& g, int s, int t, SearchLabels& labels, Queue& pq) {
+    pq.reset(g.numVertices(), g.maxWeight);
+    labels.set(s, 0, -1);
+    pq.push(s, 0);
+    
+    int settled = 0;
+    while (!pq.empty()) {
+        NodeDistance current = pq.popMin();
+        int u = current.vertex;
+        int dist = current.distance;
+        
+        if (dist > labels.dist[u]) {
+            continue;
+        }
+        settled++;
+        
+        if (u == t) {
+            break;
+        }
+        
+        for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+            int v = g.targets[e];
+            int alt = dist + g.weights[e];
+            
+            if (alt < labels.distance(v)) {
+                labels.set(v, alt, u);
+                pq.push(v, alt);
+            }
+        }
+    }
+    return settled;
+}
+
+// ==================== CONTRACTION HIERARCHY ====================
+
+/**
+ * ContractionHierarchy - Hasil preprocessing Contraction Hierarchies (CH) di atas CSRGraph
+ *
+ * Setiap vertex punya rank (urutan kontraksi). Edge hierarchy (edge asli + shortcut)
+ * disimpan dalam dua CSR yang keduanya hanya naik rank:
+ *  - up*   : edge u -> v dengan rank[v] > rank[u], diindeks dari u (pencarian maju)
+ *  - down* : edge v -> u dengan rank[v] > rank[u], diindeks dari u (pencarian mundur)
+ * Shortcut menyimpan vertex tengah (middle) untuk unpack path; edge asli middle = -1.
+ */
+struct ContractionHierarchy {
+    shared_ptr<const CSRGraph> source;  // CSR saat build; CH kadaluarsa jika CSR sudah diganti
+    vector<int> rank;
+    vector<int> upOffsets, upTargets, upWeights, upMiddles;
+    vector<int> downOffsets, downSources, downWeights, downMiddles;
+    int shortcutCount;
+    double buildMillis;
+    
+    ContractionHierarchy() : shortcutCount(0), buildMillis(0) {}
+    
+    int numVertices() const { return rank.size(); }
+    int numEdges() const { return upTargets.size() + downSources.size(); }
+    
+    // Cari edge (from -> to) di hierarchy, return false jika tidak ada
+    bool findEdge(int from, int to, int& weight, int& middle) const {
+        if (rank[to] > rank[from]) {
+            for (int e = upOffsets[from]; e < upOffsets[from + 1]; e++) {
+                if (upTargets[e] == to) {
+                    weight = upWeights[e];
+                    middle = upMiddles[e];
+                    return true;
+                }
+            }
+        } else {
+            for (int e = downOffsets[to]; e < downOffsets[to + 1]; e++) {
+                if (downSources[e] == from) {
+                    weight = downWeights[e];
+                    middle = downMiddles[e];
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+    // Unpack edge (from -> to) menjadi edge asli, vertex setelah 'from' ditambahkan ke path
+    void unpackEdge(int from, int to, vector<int>& path) const {
+        int weight, middle;
+        if (!findEdge(from, to, weight, middle) || middle == -1) {
+            path.push_back(to);
+            return;
+        }
+        unpackEdge(from, middle, path);
+        unpackEdge(middle, to, path);
+    }
+};
+
+/**
+ * ContractionBuilder - Membangun ContractionHierarchy dari CSRGraph
+ * Urutan kontraksi memakai priority lazy: edge difference + jumlah tetangga yang sudah dikontraksi.
+ * Shortcut u -> x lewat v hanya ditambahkan jika witness search (Dijkstra terbatas dari u
+ * tanpa lewat v) tidak menemukan jalan yang sama pendek atau lebih pendek.
+ */
+class ContractionBuilder {
+private:
+    struct CHEdge {
+        int node;
+        int weight;
+        int middle;
+    };
+    
+    struct Shortcut {
+        int from;
+        int to;
+        int weight;
+    };
+    
+    static const int WITNESS_SETTLE_LIMIT = 100;
+    
+    const CSRGraph& graph;
+    int n;
+    vector<vector<CHEdge>> outEdges, inEdges;      // Graph sisa (hanya vertex yang belum dikontraksi)
+    vector<vector<CHEdge>> upEdges, downEdges;     // Edge final per vertex (lihat ContractionHierarchy)
+    vector<int> deletedNeighbors;
+    vector<int> witnessDist;                       // Scratch witness search, di-reset lewat 'touched'
+    vector<int> touched;
+    vector<int> targetStamp;                       // targetStamp[x] == stamp jika x tujuan witness saat ini
+    int stamp;
+    
+    // Tambah edge atau perkecil bobotnya jika sudah ada
+    static void setEdge(vector<CHEdge>& edges, int node, int weight, int middle) {
+        for (CHEdge& edge : edges) {
+            if (edge.node == node) {
+                if (weight < edge.weight) {
+                    edge.weight = weight;
+                    edge.middle = middle;
+                }
+                return;
+            }
+        }
+        edges.push_back({node, weight, middle});
+    }
+    
+    static void eraseEdge(vector<CHEdge>& edges, int node) {
+        for (size_t i = 0; i < edges.size(); i++) {
+            if (edges[i].node == node) {
+                edges[i] = edges.back();
+                edges.pop_back();
+                return;
+            }
+        }
+    }
+    
+    // Dijkstra terbatas dari source tanpa lewat 'avoid', hasil di witnessDist.
+    // Berhenti lebih awal setelah semua targetCount tujuan (ditandai stamp) di-settle.
+    void witnessSearch(int source, int avoid, int maxDistance, int targetCount) {
+        for (int v : touched) {
+            witnessDist[v] = numeric_limits<int>::max();
+        }
+        touched.clear();
+        
+        priority_queue<NodeDistance, vector<NodeDistance>, greater<NodeDistance>> pq;
+        witnessDist[source] = 0;
+        touched.push_back(source);
+        pq.push(NodeDistance(source, 0));
+        
+        int settled = 0;
+        while (!pq.empty() && settled < WITNESS_SETTLE_LIMIT) {
+            NodeDistance current = pq.top();
+            pq.pop();
+            int u = current.vertex;
+            if (current.distance > witnessDist[u]) {
+                continue;
+            }
+            if (current.distance > maxDistance) {
+                break;
+            }
+            settled++;
+            if (targetStamp[u] == stamp && --targetCount == 0) {
+                break;
+            }
+            
+            for (const CHEdge& edge : outEdges[u]) {
+                if (edge.node == avoid) {
+                    continue;
+                }
+                int alt = current.distance + edge.weight;
+                if (alt < witnessDist[edge.node]) {
+                    if (witnessDist[edge.node] == numeric_limits<int>::max()) {
+                        touched.push_back(edge.node);
+                    }
+                    witnessDist[edge.node] = alt;
+                    pq.push(NodeDistance(edge.node, alt));
+                }
+            }
+        }
+    }
+    
+    // Shortcut yang dibutuhkan jika v dikontraksi sekarang
+    void findShortcuts(int v, vector<Shortcut>& shortcuts) {
+        shortcuts.clear();
+        if (inEdges[v].empty() || outEdges[v].empty()) {
+            return;
+        }
+        
+        int maxOut = 0;
+        stamp++;
+        for (const CHEdge& out : outEdges[v]) {
+            maxOut = max(maxOut, out.weight);
+            targetStamp[out.node] = stamp;
+        }
+        for (const CHEdge& in : inEdges[v]) {
+            witnessSearch(in.node, v, in.weight + maxOut, outEdges[v].size());
+            for (const CHEdge& out : outEdges[v]) {
+                if (out.node == in.node) {
+                    continue;
+                }
+                int viaWeight = in.weight + out.weight;
+                if (witnessDist[out.node] > viaWeight) {
+                    shortcuts.push_back({in.node, out.node, viaWeight});
+                }
+            }
+        }
+    }
+    
+    int priority(int v, vector<Shortcut>& shortcuts) {
+        findShortcuts(v, shortcuts);
+        int edgeDifference = (int)shortcuts.size() - (int)(inEdges[v].size() + outEdges[v].size());
+        return edgeDifference + deletedNeighbors[v];
+    }
+    
+    void contract(int v, const vector<Shortcut>& shortcuts) {
+        for (const CHEdge& out : outEdges[v]) {
+            upEdges[v].push_back(out);
+            eraseEdge(inEdges[out.node], v);
+            deletedNeighbors[out.node]++;
+        }
+        for (const CHEdge& in : inEdges[v]) {
+            downEdges[v].push_back(in);
+            eraseEdge(outEdges[in.node], v);
+            deletedNeighbors[in.node]++;
+        }
+        for (const Shortcut& sc : shortcuts) {
+            setEdge(outEdges[sc.from], sc.to, sc.weight, v);
+            setEdge(inEdges[sc.to], sc.from, sc.weight, v);
+        }
+        outEdges[v].clear();
+        inEdges[v].clear();
+    }
+    
+    static void flatten(const vector<vector<CHEdge>>& lists, vector<int>& offsets, vector<int>& nodes,
+                        vector<int>& weights, vector<int>& middles) {
+        offsets.assign(lists.size() + 1, 0);
+        for (size_t v = 0; v < lists.size(); v++) {
+            offsets[v + 1] = offsets[v] + lists[v].size();
+        }
+        nodes.resize(offsets.back());
+        weights.resize(offsets.back());
+        middles.resize(offsets.back());
+        for (size_t v = 0; v < lists.size(); v++) {
+            int e = offsets[v];
+            for (const CHEdge& edge : lists[v]) {
+                nodes[e] = edge.node;
+                weights[e] = edge.weight;
+                middles[e] = edge.middle;
+                e++;
+            }
+        }
+    }
+
+public:
+    explicit ContractionBuilder(const CSRGraph& g)
+        : graph(g), n(g.numVertices()), outEdges(n), inEdges(n), upEdges(n), downEdges(n),
+          deletedNeighbors(n, 0), witnessDist(n, numeric_limits<int>::max()), targetStamp(n, 0), stamp(0) {
+        for (int u = 0; u < n; u++) {
+            for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                int v = g.targets[e];
+                if (v != u) {
+                    outEdges[u].push_back({v, g.weights[e], -1});
+                    inEdges[v].push_back({u, g.weights[e], -1});
+                }
+            }
+        }
+    }
+    
+    shared_ptr<ContractionHierarchy> build() {
+        shared_ptr<ContractionHierarchy> ch = make_shared<ContractionHierarchy>();
+        ch->rank.assign(n, -1);
+        
+        vector<Shortcut> shortcuts;
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> queue;
+        for (int v = 0; v < n; v++) {
+            queue.push({priority(v, shortcuts), v});
+        }
+        
+        int order = 0;
+        while (!queue.empty()) {
+            int v = queue.top().second;
+            queue.pop();
+            if (ch->rank[v] != -1) {
+                continue;
+            }
+            
+            // Lazy update: hitung ulang priority, tunda jika sudah bukan yang terkecil
+            int current = priority(v, shortcuts);
+            if (!queue.empty() && current > queue.top().first) {
+                queue.push({current, v});
+                continue;
+            }
+            
+            ch->rank[v] = order++;
+            ch->shortcutCount += shortcuts.size();
+            contract(v, shortcuts);
+        }
+        
+        flatten(upEdges, ch->upOffsets, ch->upTargets, ch->upWeights, ch->upMiddles);
+        flatten(downEdges, ch->downOffsets, ch->downSources, ch->downWeights, ch->downMiddles);
+        return ch;
+    }
+};
+
+// ==================== ALT LANDMARKS ====================
+
+/**
+ * LandmarkTables - Tabel jarak landmark untuk ALT (A*, Landmarks, Triangle inequality)
+ *
+ * Untuk setiap vertex v dan landmark L disimpan d(L, v) dan d(v, L), row-major per vertex
+ * (index v * numLandmarks + k) agar heuristic satu vertex membaca memori yang berurutan.
+ * Lower bound d(v, t) >= max(d(L, t) - d(L, v), d(v, L) - d(t, L)) untuk semua L.
+ */
+struct LandmarkTables {
+    shared_ptr<const CSRGraph> source;  // CSR saat build; tabel kadaluarsa jika CSR sudah diganti
+    int numLandmarks;
+    vector<int> landmarks;              // Vertex ID landmark
+    vector<int> fromLandmark;           // d(L, v), INF jika tidak terjangkau
+    vector<int> toLandmark;             // d(v, L), INF jika tidak terjangkau
+    double buildMillis;
+    
+    LandmarkTables() : numLandmarks(0), buildMillis(0) {}
+};
+
+// Header file tabel landmark (.lmk); payload: int32 landmarks[K], fromLandmark[V*K], toLandmark[V*K]
+const char LANDMARK_MAGIC[8] = {'F', 'R', 'G', 'L', 'M', 'K', '\0', '\0'};
+const uint32_t LANDMARK_VERSION = 1;
+
+struct LandmarkFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianCheck;
+    uint32_t numVertices;
+    uint32_t numLandmarks;
+    uint64_t graphFingerprint;   // Checksum array CSR, tabel ditolak jika graph berbeda
+    uint64_t checksum;           // Checksum payload
+};
+
+/**
+ * computeSingleSourceDistances - Dijkstra penuh dari satu sumber di CSR
+ * @param backward: true = ikuti edge masuk (hasil d(v, source)), false = edge keluar (d(source, v))
+ * @param parent: Opsional, diisi vertex sebelumnya di tree (-1 untuk source / tidak tercapai);
+ *                untuk backward berarti vertex berikutnya menuju source
+ */
+void computeSingleSourceDistances(const CSRGraph& g, int source, bool backward, vector<int>& dist,
+                                  vector<int>* parent = nullptr) {
+    const CSRArray<int>& offsets = backward ? g.inOffsets : g.offsets;
+    const CSRArray<int>& neighbors = backward ? g.inSources : g.targets;
+    const CSRArray<int>& weights = backward ? g.inWeights : g.weights;
+    
+    dist.assign(g.numVertices(), numeric_limits<int>::max());
+    if (parent != nullptr) {
+        parent->assign(g.numVertices(), -1);
+    }
+    priority_queue<NodeDistance, vector<NodeDistance>, greater<NodeDistance>> pq;
+    dist[source] = 0;
+    pq.push(NodeDistance(source, 0));
+    
+    while (!pq.empty()) {
+        NodeDistance current = pq.top();
+        pq.pop();
+        int u = current.vertex;
+        if (current.distance > dist[u]) {
+            continue;
+        }
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            int v = neighbors[e];
+            int alt = current.distance + weights[e];
+            if (alt < dist[v]) {
+                dist[v] = alt;
+                if (parent != nullptr) {
+                    (*parent)[v] = u;
+                }
+                pq.push(NodeDistance(v, alt));
+            }
+        }
+    }
+}
+
+/**
+ * buildLandmarkTables - Pilih landmark dengan farthest-point selection lalu isi tabel jarak
+ * Landmark pertama adalah bandara terjauh dari hub terbesar; landmark berikutnya adalah
+ * bandara dengan jarak minimum terbesar ke semua landmark yang sudah dipilih.
+ * Hanya membaca CSR (immutable), aman dijalankan di thread background.
+ * @param numLandmarks: Jumlah landmark yang diinginkan (K)
+ */
+shared_ptr<LandmarkTables> buildLandmarkTables(shared_ptr<const CSRGraph> source, int numLandmarks) {
+    auto startTime = chrono::steady_clock::now();
+    const CSRGraph& g = *source;
+    const int INF = numeric_limits<int>::max();
+    int n = g.numVertices();
+    
+    shared_ptr<LandmarkTables> tables = make_shared<LandmarkTables>();
+    tables->source = source;
+    
+    // Kandidat: bandara yang punya rute keluar dan masuk
+    int hub = -1;
+    for (int v = 0; v < n; v++) {
+        int degree = (g.edgeEnd(v) - g.edgeBegin(v)) + (g.inEdgeEnd(v) - g.inEdgeBegin(v));
+        if (degree > 0 && (hub == -1 || degree > (g.edgeEnd(hub) - g.edgeBegin(hub)) +
+                                                 (g.inEdgeEnd(hub) - g.inEdgeBegin(hub)))) {
+            hub = v;
+        }
+    }
+    if (hub == -1) {
+        return tables;
+    }
+    
+    vector<int> minDist;              // Jarak terkecil dari landmark terpilih (INF = belum ada)
+    vector<int> forward, backward;
+    vector<vector<int>> fromColumns, toColumns;
+    computeSingleSourceDistances(g, hub, false, minDist);
+    
+    for (int k = 0; k < numLandmarks; k++) {
+        int next = -1;
+        for (int v = 0; v < n; v++) {
+            if (minDist[v] != INF && minDist[v] > 0 && g.edgeEnd(v) > g.edgeBegin(v) &&
+                (next == -1 || minDist[v] > minDist[next])) {
+                next = v;
+            }
+        }
+        if (next == -1) {
+            break;
+        }
+        
+        computeSingleSourceDistances(g, next, false, forward);
+        computeSingleSourceDistances(g, next, true, backward);
+        tables->landmarks.push_back(next);
+        fromColumns.push_back(forward);
+        toColumns.push_back(backward);
+        
+        // Landmark pertama menggantikan jarak dari hub
+        for (int v = 0; v < n; v++) {
+            minDist[v] = (k == 0) ? forward[v] : min(minDist[v], forward[v]);
+        }
+    }
+    
+    int K = tables->landmarks.size();
+    tables->numLandmarks = K;
+    tables->fromLandmark.resize((size_t)n * K);
+    tables->toLandmark.resize((size_t)n * K);
+    for (int v = 0; v < n; v++) {
+        for (int k = 0; k < K; k++) {
+            tables->fromLandmark[(size_t)v * K + k] = fromColumns[k][v];
+            tables->toLandmark[(size_t)v * K + k] = toColumns[k][v];
+        }
+    }
+    
+    tables->buildMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+    return tables;
+}
+
+// ==================== HUB SHORTEST-PATH TREES ====================
+
+/**
+ * HubTrees - Shortest-path tree penuh dari dan ke setiap hub
+ * Array hub-major (indeks h * n + v). fromParent[h][v] = vertex sebelum v di tree dari hub,
+ * toNext[h][v] = vertex sesudah v di tree menuju hub. Query yang asal/tujuannya hub
+ * dijawab dengan menelusuri tree: O(panjang path), tanpa Dijkstra.
+ */
+struct HubTrees {
+    shared_ptr<const CSRGraph> source;   // CSR yang dipakai saat build (untuk invalidasi)
+    vector<int> hubs;                    // Vertex ID hub
+    vector<int> hubSlot;                 // Vertex ID -> indeks hub (-1 jika bukan hub)
+    vector<int> fromDist, fromParent;
+    vector<int> toDist, toNext;
+    uint64_t graphVersion;               // Versi graph yang dicerminkan tree
+    double buildMillis;
+    
+    // Statistik perbaikan inkremental terakhir (0 jika tree baru dibangun penuh)
+    size_t repairedEdges;
+    size_t repairedVertices;
+    double repairMillis;
+    
+    HubTrees() : graphVersion(0), buildMillis(0), repairedEdges(0), repairedVertices(0), repairMillis(0) {}
+    
+    size_t memoryBytes() const {
+        return (fromDist.size() + fromParent.size() + toDist.size() + toNext.size() + hubSlot.size()) * sizeof(int);
+    }
+};
+
+/**
+ * computeHubTrees - Dua Dijkstra penuh per hub (graph maju dan terbalik)
+ * Hanya membaca CSR (immutable).
+ */
+shared_ptr<HubTrees> computeHubTrees(shared_ptr<const CSRGraph> source, const vector<int>& hubs) {
+    auto startTime = chrono::steady_clock::now();
+    const CSRGraph& g = *source;
+    int n = g.numVertices();
+    
+    shared_ptr<HubTrees> trees = make_shared<HubTrees>();
+    trees->source = source;
+    trees->hubs = hubs;
+    trees->hubSlot.assign(n, -1);
+    trees->fromDist.resize((size_t)hubs.size() * n);
+    trees->fromParent.resize((size_t)hubs.size() * n);
+    trees->toDist.resize((size_t)hubs.size() * n);
+    trees->toNext.resize((size_t)hubs.size() * n);
+    
+    vector<int> dist, parent;
+    for (size_t h = 0; h < hubs.size(); h++) {
+        trees->hubSlot[hubs[h]] = h;
+        
+        computeSingleSourceDistances(g, hubs[h], false, dist, &parent);
+        copy(dist.begin(), dist.end(), trees->fromDist.begin() + h * n);
+        copy(parent.begin(), parent.end(), trees->fromParent.begin() + h * n);
+        
+        computeSingleSourceDistances(g, hubs[h], true, dist, &parent);
+        copy(dist.begin(), dist.end(), trees->toDist.begin() + h * n);
+        copy(parent.begin(), parent.end(), trees->toNext.begin() + h * n);
+    }
+    
+    trees->buildMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+    return trees;
+}
+
+/**
+ * hubTreePath - Path s -> t dari tree hub jika s atau t adalah hub
+ * @param path: Diisi vertex ID path (kosong jika tidak terhubung)
+ * @param distance: Diisi jarak (INT_MAX jika tidak terhubung)
+ * @return: false jika s maupun t bukan hub
+ */
+bool hubTreePath(const HubTrees& trees, int s, int t, vector<int>& path, int& distance) {
+    const int INF = numeric_limits<int>::max();
+    size_t n = trees.hubSlot.size();
+    path.clear();
+    
+    if (trees.hubSlot[s] != -1) {
+        // Telusuri tree dari hub asal secara mundur: t -> parent -> ... -> s
+        size_t base = (size_t)trees.hubSlot[s] * n;
+        distance = trees.fromDist[base + t];
+        if (distance != INF) {
+            for (int v = t; v != -1; v = trees.fromParent[base + v]) {
+                path.push_back(v);
+            }
+            reverse(path.begin(), path.end());
+        }
+        return true;
+    }
+    if (trees.hubSlot[t] != -1) {
+        // Telusuri tree menuju hub tujuan secara maju: s -> next -> ... -> t
+        size_t base = (size_t)trees.hubSlot[t] * n;
+        distance = trees.toDist[base + s];
+        if (distance != INF) {
+            for (int v = s; v != -1; v = trees.toNext[base + v]) {
+                path.push_back(v);
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+// Adjacency satu arah di CSR (maju: edge keluar, terbalik: edge masuk)
+struct AdjacencyView {
+    const CSRArray<int>* offsets;
+    const CSRArray<int>* neighbors;
+    const CSRArray<int>* weights;
+    
+    int begin(int v) const { return (*offsets)[v]; }
+    int end(int v) const { return (*offsets)[v + 1]; }
+    
+    // Bobot edge u -> v, INT_MAX jika tidak ada
+    int weight(int u, int v) const {
+        for (int e = begin(u); e < end(u); e++) {
+            if ((*neighbors)[e] == v) {
+                return (*weights)[e];
+            }
+        }
+        return numeric_limits<int>::max();
+    }
+};
+
+/**
+ * repairShortestPathTree - Perbaikan inkremental satu shortest-path tree (Ramalingam-Reps)
+ * Fase 1 (edge tree memanjang / dihapus): subtree di bawah edge itu diinvalidasi, lalu
+ * setiap vertex subtree diberi kandidat jarak dari in-edge asal vertex yang tidak terkena.
+ * Fase 2 (edge memendek / ditambah): head edge yang jadi lebih dekat dijadikan seed.
+ * Semua seed diproses seperti Dijkstra yang hanya menyebar perbaikan, jadi yang dikunjungi
+ * hanya vertex yang jaraknya berubah, bukan seluruh graph.
+ * @param out: Adjacency arah tree (parent -> child), in: adjacency kebalikannya
+ * @param changes: Edge (tail, head) searah tree yang bobotnya berubah (sudah di CSR baru)
+ * @param affected: Scratch berukuran n, semua 0 saat masuk dan saat keluar
+ * @return: Jumlah vertex yang jaraknya dihitung ulang
+ */
+size_t repairShortestPathTree(const AdjacencyView& out, const AdjacencyView& in, int* dist, int* parent,
+                              const vector<pair<int, int>>& changes, vector<char>& affected) {
+    const int INF = numeric_limits<int>::max();
+    vector<int> subtree;
+    priority_queue<NodeDistance, vector<NodeDistance>, greater<NodeDistance>> pq;
+    
+    // Fase 1: kumpulkan subtree di bawah edge tree yang memanjang atau hilang
+    for (const auto& change : changes) {
+        int u = change.first;
+        int v = change.second;
+        if (parent[v] != u || affected[v]) {
+            continue;
+        }
+        int w = out.weight(u, v);
+        if (w != INF && dist[u] != INF && dist[u] + w <= dist[v]) {
+            continue;
+        }
+        
+        size_t head = subtree.size();
+        subtree.push_back(v);
+        affected[v] = 1;
+        for (; head < subtree.size(); head++) {
+            int x = subtree[head];
+            for (int e = out.begin(x); e < out.end(x); e++) {
+                int c = (*out.neighbors)[e];
+                if (!affected[c] && parent[c] == x) {
+                    affected[c] = 1;
+                    subtree.push_back(c);
+                }
+            }
+        }
+    }
+    
+    for (int x : subtree) {
+        dist[x] = INF;
+        parent[x] = -1;
+    }
+    for (int x : subtree) {
+        for (int e = in.begin(x); e < in.end(x); e++) {
+            int y = (*in.neighbors)[e];
+            if (!affected[y] && dist[y] != INF && dist[y] + (*in.weights)[e] < dist[x]) {
+                dist[x] = dist[y] + (*in.weights)[e];
+                parent[x] = y;
+            }
+        }
+        if (dist[x] != INF) {
+            pq.push(NodeDistance(x, dist[x]));
+        }
+    }
+    for (int x : subtree) {
+        affected[x] = 0;
+    }
+    
+    // Fase 2: edge yang sekarang memberi jarak lebih pendek
+    for (const auto& change : changes) {
+        int u = change.first;
+        int v = change.second;
+        int w = out.weight(u, v);
+        if (w != INF && dist[u] != INF && dist[u] + w < dist[v]) {
+            dist[v] = dist[u] + w;
+            parent[v] = u;
+            pq.push(NodeDistance(v, dist[v]));
+        }
+    }
+    
+    size_t updated = subtree.size();
+    while (!pq.empty()) {
+        NodeDistance current = pq.top();
+        pq.pop();
+        int x = current.vertex;
+        if (current.distance > dist[x]) {
+            continue;
+        }
+        for (int e = out.begin(x); e < out.end(x); e++) {
+            int c = (*out.neighbors)[e];
+            int alt = current.distance + (*out.weights)[e];
+            if (alt < dist[c]) {
+                dist[c] = alt;
+                parent[c] = x;
+                pq.push(NodeDistance(c, alt));
+                updated++;
+            }
+        }
+    }
+    return updated;
+}
+
+/**
+ * repairHubTrees - Terapkan perubahan edge ke semua tree hub tanpa rebuild penuh
+ * @param source: CSR baru (sudah memuat perubahan), jumlah vertex harus sama
+ * @param changes: Edge (from, to) yang ditambah / dihapus sejak tree terakhir
+ */
+void repairHubTrees(HubTrees& trees, shared_ptr<const CSRGraph> source, const vector<pair<int, int>>& changes) {
+    auto startTime = chrono::steady_clock::now();
+    const CSRGraph& g = *source;
+    size_t n = g.numVertices();
+    AdjacencyView forward = {&g.offsets, &g.targets, &g.weights};
+    AdjacencyView backward = {&g.inOffsets, &g.inSources, &g.inWeights};
+    
+    // Tree menuju hub memakai graph terbalik: edge (u, v) menjadi (v, u)
+    vector<pair<int, int>> reversed;
+    for (const auto& change : changes) {
+        reversed.push_back({change.second, change.first});
+    }
+    
+    vector<char> affected(n, 0);
+    size_t updated = 0;
+    for (size_t h = 0; h < trees.hubs.size(); h++) {
+        updated += repairShortestPathTree(forward, backward, &trees.fromDist[h * n], &trees.fromParent[h * n],
+                                          changes, affected);
+        updated += repairShortestPathTree(backward, forward, &trees.toDist[h * n], &trees.toNext[h * n],
+                                          reversed, affected);
+    }
+    
+    trees.source = source;
+    trees.repairedEdges = changes.size();
+    trees.repairedVertices = updated;
+    trees.repairMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+}
+
+// ==================== GRAPH SNAPSHOT (MVCC) ====================
+
+/**
+ * GraphSnapshot - Satu versi graph yang immutable untuk reader konkuren
+ * Writer tidak pernah mengubah snapshot yang sudah dipublikasikan: setiap batch update
+ * membangun CSR baru (dan memperbaiki salinan tree hub), lalu menukar pointer snapshot
+ * secara atomik. Reader yang masih memegang versi lama tetap membaca data lama sampai
+ * shared_ptr-nya dilepas, jadi query tidak pernah menunggu writer.
+ *
+ * Semua method query FlightRouteGraph mengambil snapshot() sekali di awal dan hanya
+ * membaca snapshot itu (CSR, tree hub, tabel ID, tabel rute per maskapai), jadi aman
+ * berjalan bersamaan dengan applyUpdates. Mutasi langsung lainnya (addVertex, load)
+ * tetap tidak boleh berjalan bersamaan dengan query.
+ */
+struct GraphSnapshot {
+    uint64_t version;                     // graphVersion saat dipublikasikan
+    shared_ptr<const CSRGraph> csr;
+    shared_ptr<const HubTrees> hubs;      // nullptr jika cache hub tidak aktif
+    vector<AirportId> airportIds;         // Vertex ID -> AirportId
+    vector<int> idIndex;                  // AirportId.value -> vertex ID (-1 jika tidak ada)
+    int routeCount;
+    
+    // Semua rute (termasuk beda maskapai) dalam format CSR: rute keluar v ada di
+    // routes[routeOffsets[v]..routeOffsets[v+1]), rute masuk di incomingRoutes (target = asal)
+    vector<int> routeOffsets, incomingOffsets;
+    vector<RouteRecord> routes, incomingRoutes;
+    vector<string> airlineNames;
+    
+    GraphSnapshot() : version(0), routeCount(0) {}
+    
+    int vertexId(AirportId airport) const {
+        return airport.isValid() ? idIndex[airport.value] : -1;
+    }
+    
+    vector<string> toCodes(const vector<int>& path) const {
+        vector<string> codes;
+        codes.reserve(path.size());
+        for (int v : path) {
+            codes.push_back(airportIds[v].toCode());
+        }
+        return codes;
+    }
+    
+    vector<int> toVertexIds(const vector<string>& codes) const {
+        vector<int> path;
+        path.reserve(codes.size());
+        for (const string& code : codes) {
+            path.push_back(vertexId(AirportId::fromCode(code)));
+        }
+        return path;
+    }
+    
+    // Total jarak path (vertex ID) lewat edge CSR
+    int pathDistance(const vector<int>& path) const {
+        int totalDistance = 0;
+        for (size_t i = 0; i + 1 < path.size(); i++) {
+            int e = csr->findEdge(path[i], path[i + 1]);
+            if (e != -1) {
+                totalDistance += csr->weights[e];
+            }
+        }
+        return totalDistance;
+    }
+    
+    /**
+     * findShortestPath - Dijkstra (atau tree hub) di atas versi graph ini
+     * Hanya membaca snapshot, aman dipanggil dari banyak thread dengan workspace masing-masing.
+     */
+    PathResult findShortestPath(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        PathResult result;
+        result.algorithm = "Dijkstra (Shortest Path)";
+        
+        int s = vertexId(start);
+        int t = vertexId(end);
+        if (s == -1 || t == -1) {
+            return result;
+        }
+        
+        vector<int> path;
+        int distance;
+        if (hubs && hubTreePath(*hubs, s, t, path, distance)) {
+            result.algorithm = "Dijkstra (Hub Tree Cache)";
+        } else {
+            workspace.prepare(csr->numVertices());
+            SearchLabels& labels = workspace.forward;
+            result.expandedNodes = dijkstraSearch(*csr, s, t, labels, workspace.heapForward);
+            if (labels.reached(t)) {
+                distance = labels.dist[t];
+                for (int v = t; v != -1; v = labels.parent[v]) {
+                    path.push_back(v);
+                }
+                reverse(path.begin(), path.end());
+            }
+        }
+        if (path.empty()) {
+            return result;
+        }
+        
+        result.path = toCodes(path);
+        result.stops = path.size() - 1;
+        result.totalDistance = distance;
+        result.found = true;
+        return result;
+    }
+};
+
+// Satu mutasi rute dalam batch writer (lihat applyUpdates)
+struct RouteUpdate {
+    enum Kind {
+        ADD_ROUTE,
+        REMOVE_ROUTE
+    };
+    
+    Kind kind;
+    AirportId from, to;
+    int distance;        // Hanya untuk ADD_ROUTE
+    string airline;      // Hanya untuk ADD_ROUTE
+    
+    static RouteUpdate add(AirportId from, AirportId to, int distance, const string& airline) {
+        return {ADD_ROUTE, from, to, distance, airline};
+    }
+    
+    static RouteUpdate remove(AirportId from, AirportId to) {
+        return {REMOVE_ROUTE, from, to, 0, ""};
+    }
+};
+
+// ==================== DISTANCE MATRIX ====================
+
+/**
+ * DistanceMatrix - Matriks jarak dan jumlah stops origin-destination (row-major)
+ * Elemen [i][j] ada di index i * targets.size() + j. Pasangan tidak terhubung = -1.
+ * Jika beberapa rute sama pendek, dipilih yang stops-nya paling sedikit.
+ */
+struct DistanceMatrix {
+    vector<AirportId> sources;
+    vector<AirportId> targets;
+    vector<int32_t> distances;   // km
+    vector<int16_t> stops;       // Jumlah penerbangan (edge)
+    
+    int32_t distance(size_t row, size_t col) const { return distances[row * targets.size() + col]; }
+    int16_t stopCount(size_t row, size_t col) const { return stops[row * targets.size() + col]; }
+};
+
+// Format file matriks (.bin): header, uint16 sourceCodes[S], uint16 targetCodes[T],
+// lalu per baris: int32 distances[T] diikuti int16 stops[T]
+const char MATRIX_MAGIC[8] = {'F', 'R', 'G', 'D', 'M', 'A', 'T', '\0'};
+const uint32_t MATRIX_VERSION = 1;
+
+struct MatrixFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianCheck;
+    uint32_t numSources;
+    uint32_t numTargets;
+};
+
+// Nilai hop untuk pasangan yang tidak terhubung
+const uint8_t HOP_UNREACHABLE = 255;
+
+/**
+ * HopMatrix - Jumlah stops minimum (hop) dari setiap source ke setiap bandara (row-major)
+ * Kolom = semua bandara dalam urutan vertex ID (targets). histogram[h] = jumlah pasangan
+ * berbeda (asal != tujuan) dengan jarak h hop; unreachablePairs = pasangan tidak terhubung.
+ */
+struct HopMatrix {
+    vector<AirportId> sources;
+    vector<AirportId> targets;
+    vector<uint8_t> hops;
+    vector<long long> histogram;
+    long long unreachablePairs;
+    
+    HopMatrix() : unreachablePairs(0) {}
+    
+    uint8_t hopCount(size_t row, size_t col) const { return hops[row * targets.size() + col]; }
+};
+
+// Index bit 1 terendah (word tidak boleh 0)
+inline int lowestBitIndex(uint64_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (int)index;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// ==================== MEMORY-MAPPED FILE ====================
+
+/**
+ * MappedFile - Membuka file secara read-only lewat memory mapping (mmap / MapViewOfFile)
+ * Isi file bisa dibaca langsung tanpa copy ke buffer. Jika mapping gagal,
+ * fallback membaca seluruh file ke memori.
+ */
+class MappedFile {
+private:
+    const char* mappedData;
+    size_t mappedSize;
+    string fallbackBuffer;
+    bool opened;
+#ifdef _WIN32
+    HANDLE fileHandle;
+    HANDLE mappingHandle;
+#endif
+    
+    void close() {
+        if (mappedData != nullptr && fallbackBuffer.empty()) {
+#ifdef _WIN32
+            UnmapViewOfFile(mappedData);
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+#else
+            munmap((void*)mappedData, mappedSize);
+#endif
+        }
+        mappedData = nullptr;
+        mappedSize = 0;
+        fallbackBuffer.clear();
+        opened = false;
+    }
+    
+    bool readFallback(const string& filename) {
+        ifstream file(filename, ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        ostringstream contents;
+        contents << file.rdbuf();
+        fallbackBuffer = contents.str();
+        mappedData = fallbackBuffer.data();
+        mappedSize = fallbackBuffer.size();
+        return true;
+    }
+
+public:
+    MappedFile() : mappedData(nullptr), mappedSize(0), opened(false) {}
+    ~MappedFile() { close(); }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    bool open(const string& filename) {
+        close();
+
+#ifdef _WIN32
+        fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(fileHandle, &fileSize);
+        mappedSize = (size_t)fileSize.QuadPart;
+        opened = true;
+        if (mappedSize == 0) {
+            CloseHandle(fileHandle);
+            return true;
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mappingHandle != NULL) {
+            mappedData = (const char*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            if (mappedData == nullptr) {
+                CloseHandle(mappingHandle);
+            }
+        }
+        if (mappedData == nullptr) {
+            CloseHandle(fileHandle);
+            opened = readFallback(filename);
+        }
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        mappedSize = (size_t)st.st_size;
+        opened = true;
+        if (mappedSize > 0) {
+            void* addr = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                mappedData = (const char*)addr;
+                madvise(addr, mappedSize, MADV_SEQUENTIAL);
+            } else {
+                opened = readFallback(filename);
+            }
+        }
+        ::close(fd);
+#endif
+        return opened;
+    }
+    
+    const char* data() const { return mappedData; }
+    size_t size() const { return mappedSize; }
+    bool isOpen() const { return opened; }
+};
+
+// Statistik throughput loader CSV
+struct LoadStats {
+    size_t bytes;
+    size_t rows;
+    double seconds;
+    
+    LoadStats() : bytes(0), rows(0), seconds(0) {}
+};
+
+// Satu rute hasil parsing routes.csv sebelum dimasukkan ke graph
+struct ParsedRoute {
+    int from;               // Vertex ID asal
+    int to;                 // Vertex ID tujuan
+    int distance;           // Jarak Haversine (km)
+    string_view airline;    // View ke file yang di-map (tanpa copy)
+};
+
+// Hasil parsing satu chunk routes.csv (satu chunk per thread)
+struct RouteChunk {
+    vector<ParsedRoute> routes;
+    vector<string> slowFields;  // Menjaga string_view dari baris slow-path tetap valid
+    int skipped;
+    size_t rows;
+    
+    RouteChunk() : skipped(0), rows(0) {}
+};
+
+// ==================== BINARY SNAPSHOT FORMAT ====================
+
+// Format file snapshot (semua integer little-endian / native):
+//   SnapshotHeader
+//   SnapshotVertex[V]      - tabel bandara (string di string pool)
+//   SnapshotAirline[A]     - tabel maskapai (string di string pool)
+//   double unitX[V], unitY[V], unitZ[V] - data heuristic A* (CSRGraph)
+//   int32 routeOffsets[V+1], routeTargets[E], routeDistances[E], routeAirlines[E]
+//   int32 csrOffsets[V+1], csrTargets[Ec], csrWeights[Ec]
+//   int32 csrInOffsets[V+1], csrInSources[Ec], csrInWeights[Ec]
+//   char  stringPool[...]  - dipadding ke kelipatan 8 byte
+const char SNAPSHOT_MAGIC[8] = {'F', 'R', 'G', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t SNAPSHOT_VERSION = 3;
+const uint32_t SNAPSHOT_ENDIAN_CHECK = 0x01020304;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianCheck;
+    uint32_t numVertices;
+    uint32_t numRoutes;
+    uint32_t numAirlines;
+    uint32_t numCSREdges;
+    uint64_t stringPoolSize;
+    uint64_t payloadSize;
+    uint64_t checksum;           // Checksum seluruh payload setelah header
+    uint64_t sourcePathHash;     // Hash path airports.csv + routes.csv
+    uint64_t airportsFileSize;
+    int64_t airportsFileTime;
+    uint64_t routesFileSize;
+    int64_t routesFileTime;
+    double heuristicScale;       // CSRGraph::heuristicScale
+    int32_t maxWeight;           // CSRGraph::maxWeight
+    uint32_t reserved;
+};
+
+struct SnapshotVertex {
+    int32_t airportID;
+    uint16_t code;               // AirportId.value
+    uint16_t reserved;
+    double latitude;
+    double longitude;
+    uint32_t nameOffset, nameLength;
+    uint32_t cityOffset, cityLength;
+    uint32_t countryOffset, countryLength;
+};
+
+struct SnapshotAirline {
+    uint32_t offset;
+    uint32_t length;
+};
+
+// Offset CSR di snapshot valid: dimulai 0, tidak pernah turun, berakhir tepat di total
+bool snapshotOffsetsValid(const int32_t* offsets, size_t numVertices, size_t total) {
+    if (offsets[0] != 0 || (size_t)offsets[numVertices] != total) {
+        return false;
+    }
+    for (size_t v = 0; v < numVertices; v++) {
+        if (offsets[v + 1] < offsets[v]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Semua nilai di snapshot berada di [0, limit)
+bool snapshotValuesInRange(const int32_t* values, size_t count, size_t limit) {
+    for (size_t i = 0; i < count; i++) {
+        if (values[i] < 0 || (size_t)values[i] >= limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==================== QUERY RESULT CACHE (LRU) ====================
+
+// Kunci cache hasil query; constraint -1 = tanpa batasan (selain itu mis. maxStops)
+struct QueryCacheKey {
+    AirportId origin;
+    AirportId destination;
+    QueryAlgorithm algorithm;
+    int constraint;
+    
+    bool operator==(const QueryCacheKey& other) const {
+        return origin == other.origin && destination == other.destination &&
+               algorithm == other.algorithm && constraint == other.constraint;
+    }
+};
+
+struct QueryCacheKeyHash {
+    size_t operator()(const QueryCacheKey& key) const {
+        uint64_t packed = ((uint64_t)key.origin.value << 48) | ((uint64_t)key.destination.value << 32) |
+                          ((uint64_t)key.algorithm << 24) | (uint32_t)(key.constraint & 0xFFFFFF);
+        return hash<uint64_t>()(packed);
+    }
+};
+
+struct QueryCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;      // Dibuang karena kapasitas penuh (LRU)
+    uint64_t invalidations;  // Dibuang karena versi graph berubah
+    size_t size;
+    size_t capacity;
+};
+
+/**
+ * PathResultCache - Cache LRU PathResult yang terbatas dan thread-safe
+ * Entry menyimpan versi graph saat dihitung. Lookup dengan versi berbeda dihitung miss
+ * dan entry langsung dibuang, jadi hanya hasil yang benar-benar basi yang hilang.
+ * Kapasitas 0 = cache mati (lookup tidak mengambil lock).
+ */
+class PathResultCache {
+private:
+    struct Entry {
+        QueryCacheKey key;
+        uint64_t version;
+        PathResult result;
+    };
+    
+    mutable mutex lock;
+    list<Entry> entries;   // Depan = paling baru dipakai
+    unordered_map<QueryCacheKey, list<Entry>::iterator, QueryCacheKeyHash> index;
+    atomic<size_t> capacity;
+    uint64_t hits, misses, evictions, invalidations;
+    
+    void evictOverflow() {
+        while (entries.size() > capacity) {
+            index.erase(entries.back().key);
+            entries.pop_back();
+            evictions++;
+        }
+    }
+
+public:
+    PathResultCache() : capacity(0), hits(0), misses(0), evictions(0), invalidations(0) {}
+    
+    bool enabled() const { return capacity.load(memory_order_relaxed) > 0; }
+    
+    void setCapacity(size_t newCapacity) {
+        lock_guard<mutex> guard(lock);
+        capacity = newCapacity;
+        evictOverflow();
+    }
+    
+    bool lookup(const QueryCacheKey& key, uint64_t version, PathResult& result) {
+        lock_guard<mutex> guard(lock);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            misses++;
+            return false;
+        }
+        if (it->second->version != version) {
+            entries.erase(it->second);
+            index.erase(it);
+            invalidations++;
+            misses++;
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        result = it->second->result;
+        hits++;
+        return true;
+    }
+    
+    void store(const QueryCacheKey& key, uint64_t version, const PathResult& result) {
+        lock_guard<mutex> guard(lock);
+        if (capacity == 0) {
+            return;
+        }
+        auto it = index.find(key);
+        if (it != index.end()) {
+            it->second->version = version;
+            it->second->result = result;
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+        entries.push_front(Entry{key, version, result});
+        index[key] = entries.begin();
+        evictOverflow();
+    }
+    
+    void clear() {
+        lock_guard<mutex> guard(lock);
+        entries.clear();
+        index.clear();
+        hits = misses = evictions = invalidations = 0;
+    }
+    
+    QueryCacheStats stats() const {
+        lock_guard<mutex> guard(lock);
+        return QueryCacheStats{hits, misses, evictions, invalidations, entries.size(), capacity};
+    }
+};
+
+// ==================== FORWARD DECLARATIONS ====================
+double calculateDistance(double lat1, double lon1, double lat2, double lon2);
+vector<string> parseCSVLine(const string& line);
+void splitCSVFields(string_view line, vector<string_view>& fields, vector<string>& slowFields);
+bool parseIntField(string_view field, int& value);
+bool parseDoubleField(string_view field, double& value);
+void printLoadStats(const string& filename, const LoadStats& stats);
+uint64_t computeChecksum(const char* data, size_t size);
+bool getFileStamp(const string& filename, uint64_t& size, int64_t& modifiedTime);
+string toUpperCase(string str);
+string trim(const string& str);
+bool isValidAirportCode(const string& code);
+
+// ==================== CLASS FLIGHT ROUTE GRAPH ====================
+
+class FlightRouteGraph {
+private:
+    vector<Airport> airports;                 // Data bandara, index = vertex ID
+    vector<AirportId> airportIds;             // Vertex ID -> AirportId (packed code)
+    vector<int> idIndex;                      // AirportId.value -> vertex ID (-1 jika tidak ada)
+    vector<vector<RouteRecord>> routeTable;   // Semua rute per bandara asal (termasuk beda maskapai)
+    vector<vector<RouteRecord>> incomingTable;// Reverse index: rute per bandara tujuan (target = asal)
+    vector<string> airlineNames;              // Airline ID -> kode maskapai
+    unordered_map<string, int> airlineToId;   // Kode maskapai -> airline ID
+    int totalRouteCount;
+    int loadThreads;                          // Jumlah thread loader routes (0 = otomatis)
+    
+    // CSR untuk pathfinding, dibangun ulang secara lazy setelah graph berubah.
+    // Hanya dibaca writer (publishSnapshotLocked) dan fungsi admin; query memakai snapshot().
+    mutable shared_ptr<const CSRGraph> csrCache;
+    mutable bool csrDirty;
+    
+    // Contraction hierarchy untuk CSR snapshot terakhir yang memintanya; dibangun ulang jika CSR berubah
+    mutable mutex chMutex;
+    mutable shared_ptr<const ContractionHierarchy> chCache;
+    
+    // Versi graph, naik setiap mutasi (invalidasi cache hasil query). Atomic karena dibaca
+    // cachedQuery/getGraphVersion dari thread reader sementara writer menaikkannya.
+    atomic<uint64_t> graphVersion;
+    mutable PathResultCache resultCache;
+    
+    // Shortest-path tree hub (opt-in). Setelah addEdge/removeEdge tree diperbaiki secara
+    // inkremental dari daftar edge yang berubah; mutasi lain memicu rebuild penuh.
+    vector<AirportId> hubAirports;
+    mutable shared_ptr<HubTrees> hubCache;
+    mutable vector<pair<int, int>> pendingEdgeChanges;
+    bool hubRepairEnabled;
+    
+    // Versi graph terakhir untuk reader konkuren; dibaca/ditulis hanya lewat atomic_load/atomic_store.
+    // writerMutex menserialisasi writer (applyUpdates, publishSnapshot), reader tidak pernah lock.
+    mutable shared_ptr<const GraphSnapshot> publishedSnapshot;
+    mutable mutex writerMutex;
+    
+    // Tabel landmark ALT; setelah graph berubah dibangun ulang di thread background
+    int landmarkCount;
+    mutable mutex landmarkMutex;
+    mutable shared_ptr<const LandmarkTables> landmarkCache;
+    mutable future<shared_ptr<LandmarkTables>> landmarkJob;
+    
+    int internAirline(const string& airline) {
+        auto it = airlineToId.find(airline);
+        if (it != airlineToId.end()) {
+            return it->second;
+        }
+        int airlineId = airlineNames.size();
+        airlineNames.push_back(airline);
+        airlineToId[airline] = airlineId;
+        return airlineId;
+    }
+    
+    // Tambah rute berdasarkan vertex ID (tanpa validasi, dipakai loader)
+    void addRoute(int from, int to, int distance, int airlineId) {
+        routeTable[from].push_back(RouteRecord(to, distance, airlineId));
+        incomingTable[to].push_back(RouteRecord(from, distance, airlineId));
+        totalRouteCount++;
+        markGraphChanged();
+    }
+    
+    // Counting sort stabil untuk edges berdasarkan key dalam range [0, numKeys)
+    template <typename KeyFn>
+    static void countingSortEdges(vector<RouteEdge>& edges, vector<RouteEdge>& buffer,
+                                  int numKeys, KeyFn key) {
+        vector<int> bucketStart(numKeys + 1, 0);
+        for (const RouteEdge& edge : edges) {
+            bucketStart[key(edge) + 1]++;
+        }
+        for (int k = 0; k < numKeys; k++) {
+            bucketStart[k + 1] += bucketStart[k];
+        }
+        buffer.resize(edges.size());
+        for (const RouteEdge& edge : edges) {
+            buffer[bucketStart[key(edge)]++] = edge;
+        }
+        edges.swap(buffer);
+    }
+    
+    // Samakan jarak rute (from -> route.target) di reverse index setelah dedup memperbarui jarak
+    void updateIncomingDistance(int from, const RouteRecord& route, int newDistance) {
+        for (RouteRecord& in : incomingTable[route.target]) {
+            if (in.target == from && in.airline == route.airline && in.distance == route.distance) {
+                in.distance = newDistance;
+                return;
+            }
+        }
+    }
+    
+    /**
+     * addRoutesBulk - Bulk build: sort (from, to, airline) lalu dedup dan append dalam satu pass
+     * Sort memakai 3x counting sort (LSD radix), sehingga total O(E + V + A), bukan O(E * deg).
+     * Edge yang sudah ada di graph ikut diperhitungkan saat dedup.
+     * @return: Jumlah rute yang benar-benar ditambahkan
+     */
+    int addRoutesBulk(vector<RouteEdge>& edges, DuplicatePolicy policy) {
+        vector<RouteEdge> buffer;
+        countingSortEdges(edges, buffer, max(1, (int)airlineNames.size()),
+                          [](const RouteEdge& e) { return e.airline; });
+        countingSortEdges(edges, buffer, AIRPORT_ID_SPACE,
+                          [this](const RouteEdge& e) { return (int)airportIds[e.to].value; });
+        countingSortEdges(edges, buffer, max(1, (int)airports.size()),
+                          [](const RouteEdge& e) { return e.from; });
+        
+        vector<int> existingFrom(airports.size(), -1);   // existingFrom[to] == from: rute lama from->to ada
+        int added = 0;
+        size_t i = 0;
+        
+        while (i < edges.size()) {
+            int from = edges[i].from;
+            size_t groupEnd = i;
+            while (groupEnd < edges.size() && edges[groupEnd].from == from) {
+                groupEnd++;
+            }
+            
+            vector<RouteRecord>& routes = routeTable[from];
+            size_t existingCount = routes.size();
+            for (const RouteRecord& r : routes) {
+                existingFrom[r.target] = from;
+            }
+            routes.reserve(existingCount + (groupEnd - i));
+            
+            for (size_t k = i; k < groupEnd; k++) {
+                const RouteEdge& edge = edges[k];
+                bool samePair = k > i && edges[k - 1].to == edge.to;
+                RouteRecord* previous = routes.size() > existingCount ? &routes.back() : nullptr;
+                
+                // Duplikat di dalam batch (berurutan setelah sort)
+                if (samePair && previous != nullptr && previous->target == edge.to &&
+                    (policy == DuplicatePolicy::ONE_EDGE_PER_PAIR || previous->airline == edge.airline)) {
+                    if (edge.distance < previous->distance) {
+                        updateIncomingDistance(from, *previous, edge.distance);
+                        previous->distance = edge.distance;
+                    }
+                    continue;
+                }
+                
+                // Duplikat terhadap rute yang sudah ada sebelum batch
+                if (existingFrom[edge.to] == from) {
+                    bool duplicate = false;
+                    for (size_t r = 0; r < existingCount; r++) {
+                        if (routes[r].target == edge.to &&
+                            (policy == DuplicatePolicy::ONE_EDGE_PER_PAIR || routes[r].airline == edge.airline)) {
+                            if (edge.distance < routes[r].distance) {
+                                updateIncomingDistance(from, routes[r], edge.distance);
+                                routes[r].distance = edge.distance;
+                            }
+                            duplicate = true;
+                            break;
+                        }
+                    }
+                    if (duplicate) continue;
+                }
+                
+                routes.push_back(RouteRecord(edge.to, edge.distance, edge.airline));
+                incomingTable[edge.to].push_back(RouteRecord(from, edge.distance, edge.airline));
+                added++;
+            }
+            
+            i = groupEnd;
+        }
+        
+        totalRouteCount += added;
+        markGraphChanged();
+        return added;
+    }
+    
+    // Bangun array CSR dari tabel rute: dedup per pasangan, ambil jarak minimum, urut per kode
+    void buildCSRArrays(const vector<vector<RouteRecord>>& table, vector<int>& offsets,
+                        vector<int>& targets, vector<int>& weights) const {
+        int n = airports.size();
+        
+        offsets.assign(n + 1, 0);
+        targets.reserve(totalRouteCount);
+        weights.reserve(totalRouteCount);
+        
+        vector<int> slot(n, -1);          // Posisi edge (v, target) di baris saat ini
+        vector<pair<int, int>> row;       // Buffer untuk sorting satu baris
+        
+        for (int v = 0; v < n; v++) {
+            int rowStart = targets.size();
+            
+            for (const RouteRecord& r : table[v]) {
+                if (slot[r.target] < rowStart) {
+                    slot[r.target] = targets.size();
+                    targets.push_back(r.target);
+                    weights.push_back(r.distance);
+                } else if (r.distance < weights[slot[r.target]]) {
+                    weights[slot[r.target]] = r.distance;
+                }
+            }
+            
+            // Urutkan baris berdasarkan kode IATA
+            row.clear();
+            for (int e = rowStart; e < (int)targets.size(); e++) {
+                row.push_back({targets[e], weights[e]});
+            }
+            sort(row.begin(), row.end(), [this](const pair<int, int>& a, const pair<int, int>& b) {
+                return airportIds[a.first] < airportIds[b.first];
+            });
+            for (size_t i = 0; i < row.size(); i++) {
+                targets[rowStart + i] = row[i].first;
+                weights[rowStart + i] = row[i].second;
+            }
+            
+            offsets[v + 1] = targets.size();
+        }
+    }
+    
+    /**
+     * buildHeuristicData - Isi vektor satuan bandara dan heuristicScale untuk A*
+     * Bobot edge adalah jarak Haversine yang dipotong ke int (dan addEdgesBulk boleh memberi
+     * jarak sendiri), jadi bobot bisa sedikit lebih kecil dari jarak great-circle.
+     * Dengan scale = min(weight / greatCircle) atas semua edge, h(v) = floor(scale * greatCircle(v, t))
+     * tidak pernah melebihi jarak sebenarnya dan tetap konsisten.
+     * Scale 0 jika ada edge berbobot 0 antar koordinat berbeda (A* menjadi Dijkstra biasa).
+     * Sekalian mencatat maxWeight untuk bucket queue Dial.
+     */
+    void buildHeuristicData(CSRGraph& g) const {
+        int n = g.numVertices();
+        vector<double> unitX(n), unitY(n), unitZ(n);
+        for (int v = 0; v < n; v++) {
+            double lat = airports[v].latitude * M_PI / 180.0;
+            double lon = airports[v].longitude * M_PI / 180.0;
+            unitX[v] = cos(lat) * cos(lon);
+            unitY[v] = cos(lat) * sin(lon);
+            unitZ[v] = sin(lat);
+        }
+        g.unitX.assign(move(unitX));
+        g.unitY.assign(move(unitY));
+        g.unitZ.assign(move(unitZ));
+        
+        double scale = 1.0;
+        g.maxWeight = 0;
+        for (int u = 0; u < n; u++) {
+            for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                g.maxWeight = max(g.maxWeight, g.weights[e]);
+                double distance = g.greatCircle(u, g.targets[e]);
+                if (distance > 0) {
+                    scale = min(scale, g.weights[e] / distance);
+                }
+            }
+        }
+        // Margin kecil untuk error floating point
+        g.heuristicScale = max(0.0, scale * (1.0 - 1e-9));
+    }
+    
+    // Bangun CSR (edge keluar + edge masuk) dari routeTable dan incomingTable
+    void rebuildCSR() const {
+        shared_ptr<CSRGraph> g = make_shared<CSRGraph>();
+        vector<int> offsets, targets, weights;
+        buildCSRArrays(routeTable, offsets, targets, weights);
+        g->offsets.assign(move(offsets));
+        g->targets.assign(move(targets));
+        g->weights.assign(move(weights));
+        buildCSRArrays(incomingTable, offsets, targets, weights);
+        g->inOffsets.assign(move(offsets));
+        g->inSources.assign(move(targets));
+        g->inWeights.assign(move(weights));
+        buildHeuristicData(*g);
+        
+        csrCache = g;
+        csrDirty = false;
+    }
+    
+    // Dipanggil setiap graph berubah: CSR perlu dibangun ulang, versi graph naik
+    void markGraphChanged() {
+        csrDirty = true;
+        graphVersion++;
+    }
+    
+    const CSRGraph& csr() const {
+        if (csrDirty || !csrCache) {
+            rebuildCSR();
+        }
+        return *csrCache;
+    }
+    
+    shared_ptr<const ContractionHierarchy> contractionHierarchy(const shared_ptr<const CSRGraph>& source) const {
+        lock_guard<mutex> lock(chMutex);
+        if (!chCache || chCache->source != source) {
+            auto startTime = chrono::steady_clock::now();
+            shared_ptr<ContractionHierarchy> ch = ContractionBuilder(*source).build();
+            ch->source = source;
+            ch->buildMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+            chCache = ch;
+        }
+        return chCache;
+    }
+    
+    // Tree hub untuk CSR saat ini, nullptr jika cache hub tidak aktif
+    const HubTrees* hubTrees() const {
+        if (hubAirports.empty()) {
+            return nullptr;
+        }
+        csr();
+        if (!hubCache || hubCache->source != csrCache) {
+            // Perbaikan inkremental hanya jika SEMUA mutasi sejak tree terakhir adalah edge tercatat
+            bool repairable = hubRepairEnabled && hubCache &&
+                              hubCache->graphVersion + pendingEdgeChanges.size() == graphVersion &&
+                              hubCache->hubSlot.size() == (size_t)csrCache->numVertices();
+            if (repairable) {
+                // Copy-on-write: tree yang masih dipegang snapshot terpublikasi tidak boleh diubah
+                if (hubCache.use_count() > 1) {
+                    hubCache = make_shared<HubTrees>(*hubCache);
+                }
+                repairHubTrees(*hubCache, csrCache, pendingEdgeChanges);
+            } else {
+                vector<int> hubs;
+                for (AirportId hub : hubAirports) {
+                    int id = getVertexId(hub);
+                    if (id != -1) {
+                        hubs.push_back(id);
+                    }
+                }
+                hubCache = computeHubTrees(csrCache, hubs);
+            }
+            hubCache->graphVersion = graphVersion;
+            pendingEdgeChanges.clear();
+        }
+        return hubCache.get();
+    }
+    
+    // Catat edge yang berubah untuk perbaikan tree hub (hanya jika tree hub sudah ada)
+    void recordEdgeChange(int from, int to) {
+        if (hubCache) {
+            pendingEdgeChanges.push_back({from, to});
+        }
+    }
+    
+    // Ambil hasil dari cache LRU jika aktif dan versi graph sama; jika tidak, hitung lalu simpan.
+    // Kunci versi diambil dari snapshot yang dipakai compute, jadi hasil selalu cocok dengan versinya.
+    template <typename Compute>
+    PathResult cachedQuery(const GraphSnapshot& view, AirportId start, AirportId end, QueryAlgorithm algorithm,
+                           int constraint, Compute compute) const {
+        if (!resultCache.enabled()) {
+            return compute();
+        }
+        QueryCacheKey key{start, end, algorithm, constraint};
+        uint64_t version = view.version;
+        PathResult result;
+        if (resultCache.lookup(key, version, result)) {
+            return result;
+        }
+        result = compute();
+        resultCache.store(key, version, result);
+        return result;
+    }
+    
+    /**
+     * currentLandmarks - Tabel landmark yang cocok dengan CSR source (dari snapshot)
+     * Jika tabel kadaluarsa (graph berubah), rebuild dijalankan di background dengan CSR
+     * tersebut (immutable) dan fungsi ini return nullptr sampai rebuild selesai.
+     */
+    shared_ptr<const LandmarkTables> currentLandmarks(const shared_ptr<const CSRGraph>& source) const {
+        lock_guard<mutex> lock(landmarkMutex);
+        if (landmarkJob.valid() && landmarkJob.wait_for(chrono::seconds(0)) == future_status::ready) {
+            landmarkCache = landmarkJob.get();
+        }
+        if (landmarkCache && landmarkCache->source == source) {
+            return landmarkCache;
+        }
+        if (!landmarkJob.valid()) {
+            landmarkJob = async(launch::async, buildLandmarkTables, source, landmarkCount);
+        }
+        return nullptr;
+    }
+    
+    // Seperti currentLandmarks, tapi menunggu rebuild background selesai
+    shared_ptr<const LandmarkTables> waitForLandmarks(const shared_ptr<const CSRGraph>& source) const {
+        shared_ptr<const LandmarkTables> tables = currentLandmarks(source);
+        if (!tables) {
+            {
+                lock_guard<mutex> lock(landmarkMutex);
+                if (landmarkJob.valid()) {
+                    landmarkJob.wait();
+                }
+            }
+            tables = currentLandmarks(source);
+        }
+        return tables;
+    }
+    
+    // Checksum array CSR untuk mencocokkan file landmark dengan graph
+    uint64_t graphFingerprint(const CSRGraph& g) const {
+        uint64_t hash = computeChecksum((const char*)g.offsets.data(), g.offsets.size() * sizeof(int));
+        hash = hash * 31 + computeChecksum((const char*)g.targets.data(), g.targets.size() * sizeof(int));
+        hash = hash * 31 + computeChecksum((const char*)g.weights.data(), g.weights.size() * sizeof(int));
+        return hash;
+    }
+    
+    vector<int> reconstructPath(const vector<int>& parent, int start, int end) const {
+        vector<int> path;
+        int current = end;
+        
+        while (current != start) {
+            path.push_back(current);
+            if (parent[current] == -1) {
+                return vector<int>();
+            }
+            current = parent[current];
+        }
+        path.push_back(start);
+        reverse(path.begin(), path.end());
+        
+        return path;
+    }
+
+public:
+    FlightRouteGraph()
+        : idIndex(AIRPORT_ID_SPACE, -1), totalRouteCount(0), loadThreads(0), csrDirty(true), graphVersion(0),
+          hubRepairEnabled(true), landmarkCount(16) {}
+    
+    // AirportId -> vertex ID dalam O(1), return -1 jika tidak ada
+    int getVertexId(AirportId airport) const {
+        if (!airport.isValid()) {
+            return -1;
+        }
+        return idIndex[airport.value];
+    }
+    
+    int getVertexId(const string& airportCode) const {
+        return getVertexId(AirportId::fromCode(airportCode));
+    }
+    
+    // ==================== FUNGSI DASAR GRAPH ====================
+    
+    void addVertex(const string& airportCode, const string& airportName, int airportID,
+                   const string& city = "", const string& country = "", 
+                   double latitude = 0, double longitude = 0) {
+        AirportId airport = AirportId::fromCode(airportCode);
+        if (!airport.isValid()) {
+            cerr << "Error: Kode bandara '" << airportCode << "' tidak valid!" << endl;
+            return;
+        }
+        if (idIndex[airport.value] != -1) {
+            return;
+        }
+        
+        idIndex[airport.value] = airports.size();
+        airportIds.push_back(airport);
+        airports.push_back(Airport(airportCode, airportName, airportID, city, country, latitude, longitude));
+        routeTable.push_back(vector<RouteRecord>());
+        incomingTable.push_back(vector<RouteRecord>());
+        markGraphChanged();
+    }
+    
+    void addEdge(const string& from, const string& to, int distance, const string& airline) {
+        addEdge(AirportId::fromCode(from), AirportId::fromCode(to), distance, airline);
+    }
+    
+    void addEdge(AirportId from, AirportId to, int distance, const string& airline) {
+        int fromId = getVertexId(from);
+        int toId = getVertexId(to);
+        
+        if (fromId == -1) {
+            cerr << "Error: Bandara asal '" << from.toCode() << "' tidak ditemukan!" << endl;
+            return;
+        }
+        if (toId == -1) {
+            cerr << "Error: Bandara tujuan '" << to.toCode() << "' tidak ditemukan!" << endl;
+            return;
+        }
+        
+        // Semua maskapai disimpan untuk displayNeighbors;
+        // CSR untuk pathfinding hanya menyimpan satu edge per (from, to) pair
+        addRoute(fromId, toId, distance, internAirline(airline));
+        recordEdgeChange(fromId, toId);
+    }
+    
+    /**
+     * addEdgesBulk - Menambahkan banyak rute sekaligus dalam waktu linear
+     * Untuk perubahan kecil tetap gunakan addEdge.
+     * @param edges: Daftar rute (from, to, distance, airline)
+     * @param policy: KEEP_ALL_AIRLINES (satu rute per maskapai) atau ONE_EDGE_PER_PAIR
+     * @return: Jumlah rute yang ditambahkan setelah dedup
+     */
+    int addEdgesBulk(const vector<BulkEdge>& edges,
+                     DuplicatePolicy policy = DuplicatePolicy::KEEP_ALL_AIRLINES) {
+        vector<RouteEdge> batch;
+        batch.reserve(edges.size());
+        int skipped = 0;
+        
+        for (const BulkEdge& edge : edges) {
+            int fromId = getVertexId(edge.from);
+            int toId = getVertexId(edge.to);
+            if (fromId == -1 || toId == -1) {
+                skipped++;
+                continue;
+            }
+            batch.push_back({fromId, toId, edge.distance, internAirline(edge.airline)});
+        }
+        
+        if (skipped > 0) {
+            cerr << "Warning: " << skipped << " rute dilewati (bandara tidak ditemukan)" << endl;
+        }
+        
+        return addRoutesBulk(batch, policy);
+    }
+    
+    // ==================== FUNGSI BARU: GRAPH OPERATIONS ====================
+    
+    /**
+     * removeEdge - Menghapus edge (rute) dari graph
+     * @param from: Bandara asal
+     * @param to: Bandara tujuan
+     * @return: true jika berhasil dihapus, false jika tidak ditemukan
+     */
+    bool removeEdge(const string& from, const string& to) {
+        return removeEdge(AirportId::fromCode(from), AirportId::fromCode(to));
+    }
+    
+    bool removeEdge(AirportId from, AirportId to) {
+        int fromId = getVertexId(from);
+        int toId = getVertexId(to);
+        
+        // Check apakah vertex exist
+        if (fromId == -1) {
+            cerr << "Error: Bandara asal '" << from.toCode() << "' tidak ditemukan!" << endl;
+            return false;
+        }
+        if (toId == -1) {
+            cerr << "Error: Bandara tujuan '" << to.toCode() << "' tidak ditemukan!" << endl;
+            return false;
+        }
+        
+        // Cari dan hapus edge
+        // Tidak berhenti di match pertama karena bisa ada multiple routes dengan airline berbeda
+        vector<RouteRecord>& routes = routeTable[fromId];
+        size_t before = routes.size();
+        routes.erase(remove_if(routes.begin(), routes.end(),
+                               [toId](const RouteRecord& r) { return r.target == toId; }),
+                     routes.end());
+        bool found = routes.size() != before;
+        
+        if (!found) {
+            cerr << "Warning: Rute " << from.toCode() << " → " << to.toCode() << " tidak ditemukan!" << endl;
+        } else {
+            vector<RouteRecord>& incoming = incomingTable[toId];
+            incoming.erase(remove_if(incoming.begin(), incoming.end(),
+                                     [fromId](const RouteRecord& r) { return r.target == fromId; }),
+                           incoming.end());
+            totalRouteCount -= before - routes.size();
+            markGraphChanged();
+            recordEdgeChange(fromId, toId);
+        }
+        
+        return found;
+    }
+    
+    /**
+     * hasVertex - Mengecek apakah vertex (bandara) ada dalam graph
+     * @param airportCode: Kode bandara (contoh: "CGK")
+     * @return: true jika ada, false jika tidak
+     */
+    bool hasVertex(const string& airportCode) const {
+        return hasVertex(AirportId::fromCode(airportCode));
+    }
+    
+    bool hasVertex(AirportId airport) const {
+        return getVertexId(airport) != -1;
+    }
+    
+    /**
+     * hasEdge - Mengecek apakah edge (rute) ada dalam graph
+     * @param from: Bandara asal
+     * @param to: Bandara tujuan
+     * @return: true jika rute exist, false jika tidak
+     */
+    bool hasEdge(const string& from, const string& to) const {
+        return hasEdge(AirportId::fromCode(from), AirportId::fromCode(to));
+    }
+    
+    bool hasEdge(AirportId from, AirportId to) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int fromId = view->vertexId(from);
+        int toId = view->vertexId(to);
+        
+        // Check apakah vertex exist
+        if (fromId == -1 || toId == -1) {
+            return false;
+        }
+        
+        return view->csr->findEdge(fromId, toId) != -1;
+    }
+    
+    /**
+     * indegree - Menghitung jumlah edge yang MASUK ke vertex
+     * @param airportCode: Kode bandara
+     * @return: Jumlah rute yang menuju ke bandara ini
+     */
+    int indegree(const string& airportCode) const {
+        return indegree(AirportId::fromCode(airportCode));
+    }
+    
+    int indegree(AirportId airport) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int id = view->vertexId(airport);
+        
+        // Check apakah vertex exist
+        if (id == -1) {
+            cerr << "Error: Bandara '" << airport.toCode() << "' tidak ditemukan!" << endl;
+            return -1;
+        }
+        
+        // Lookup O(1) di reverse index (disinkronkan oleh addEdge/removeEdge)
+        return view->incomingOffsets[id + 1] - view->incomingOffsets[id];
+    }
+    
+    /**
+     * outdegree - Menghitung jumlah edge yang KELUAR dari vertex
+     * @param airportCode: Kode bandara
+     * @return: Jumlah rute yang berangkat dari bandara ini
+     */
+    int outdegree(const string& airportCode) const {
+        return outdegree(AirportId::fromCode(airportCode));
+    }
+    
+    int outdegree(AirportId airport) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int id = view->vertexId(airport);
+        
+        // Check apakah vertex exist
+        if (id == -1) {
+            cerr << "Error: Bandara '" << airport.toCode() << "' tidak ditemukan!" << endl;
+            return -1;
+        }
+        
+        // Return jumlah routes dari bandara ini
+        return view->routeOffsets[id + 1] - view->routeOffsets[id];
+    }
+    
+    // ==================== END FUNGSI BARU ====================
+    
+    vector<Route> getNeighbors(const string& airportCode) const {
+        return getNeighbors(AirportId::fromCode(airportCode));
+    }
+    
+    vector<Route> getNeighbors(AirportId airport) const {
+        vector<Route> neighbors;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int id = view->vertexId(airport);
+        if (id == -1) {
+            return neighbors;
+        }
+        
+        neighbors.reserve(view->routeOffsets[id + 1] - view->routeOffsets[id]);
+        for (int i = view->routeOffsets[id]; i < view->routeOffsets[id + 1]; i++) {
+            const RouteRecord& r = view->routes[i];
+            neighbors.push_back(Route(view->airportIds[r.target].toCode(), r.distance,
+                                      view->airlineNames[r.airline]));
+        }
+        return neighbors;
+    }
+    
+    /**
+     * getIncoming - Mengambil semua rute yang MENUJU ke bandara (predecessor)
+     * @param airportCode: Kode bandara tujuan
+     * @return: Daftar rute masuk (bandara asal, jarak, maskapai)
+     */
+    vector<IncomingRoute> getIncoming(const string& airportCode) const {
+        return getIncoming(AirportId::fromCode(airportCode));
+    }
+    
+    vector<IncomingRoute> getIncoming(AirportId airport) const {
+        vector<IncomingRoute> incoming;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int id = view->vertexId(airport);
+        if (id == -1) {
+            return incoming;
+        }
+        
+        incoming.reserve(view->incomingOffsets[id + 1] - view->incomingOffsets[id]);
+        for (int i = view->incomingOffsets[id]; i < view->incomingOffsets[id + 1]; i++) {
+            const RouteRecord& r = view->incomingRoutes[i];
+            incoming.push_back(IncomingRoute(view->airportIds[r.target].toCode(), r.distance,
+                                             view->airlineNames[r.airline]));
+        }
+        return incoming;
+    }
+    
+    // ==================== BFS - DENGAN RETURN PATHRESULT ====================
+    PathResult findPathBFS(const string& start, const string& end) const {
+        return findPathBFS(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findPathBFS(AirportId start, AirportId end) const {
+        return findPathBFS(start, end, threadWorkspace());
+    }
+    
+    PathResult findPathBFS(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        return cachedQuery(*view, start, end, QueryAlgorithm::BFS, -1,
+                           [&]() { return computePathBFS(*view, start, end, workspace); });
+    }
+
+private:
+    PathResult computePathBFS(const GraphSnapshot& view, AirportId start, AirportId end,
+                               SearchWorkspace& workspace) const {
+        PathResult result;
+        result.algorithm = "BFS (Breadth-First Search)";
+        
+        int s = view.vertexId(start);
+        int t = view.vertexId(end);
+        if (s == -1 || t == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        const CSRGraph& g = *view.csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;
+        vector<int>& q = workspace.frontier;   // Queue: q[head..]
+        size_t head = 0;
+        
+        q.push_back(s);
+        labels.set(s, 0, -1);
+        
+        while (head < q.size()) {
+            int current = q[head++];
+            
+            if (current == t) {
+                vector<int> path = reconstructPath(labels.parent, s, t);
+                result.path = view.toCodes(path);
+                result.stops = path.size() - 1;
+                result.totalDistance = view.pathDistance(path);
+                result.found = true;
+                return result;
+            }
+            
+            // Baris CSR sudah unik dan terurut per kode, tidak perlu set lagi
+            for (int e = g.edgeBegin(current); e < g.edgeEnd(current); e++) {
+                int neighbor = g.targets[e];
+                if (!labels.reached(neighbor)) {
+                    labels.set(neighbor, 0, current);
+                    q.push_back(neighbor);
+                }
+            }
+        }
+        
+        result.found = false;
+        return result;
+    }
+    
+public:
+    // ==================== DFS - DENGAN RETURN PATHRESULT ====================
+    PathResult findPathDFS(const string& start, const string& end) const {
+        return findPathDFS(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findPathDFS(AirportId start, AirportId end) const {
+        return findPathDFS(start, end, threadWorkspace());
+    }
+    
+    PathResult findPathDFS(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        return cachedQuery(*view, start, end, QueryAlgorithm::DFS, -1,
+                           [&]() { return computePathDFS(*view, start, end, workspace); });
+    }
+
+private:
+    PathResult computePathDFS(const GraphSnapshot& view, AirportId start, AirportId end,
+                               SearchWorkspace& workspace) const {
+        PathResult result;
+        result.algorithm = "DFS (Depth-First Search)";
+        
+        int s = view.vertexId(start);
+        int t = view.vertexId(end);
+        if (s == -1 || t == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        const CSRGraph& g = *view.csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;
+        vector<int>& st = workspace.frontier;  // Stack
+        
+        st.push_back(s);
+        labels.set(s, 0, -1);
+        
+        while (!st.empty()) {
+            int current = st.back();
+            st.pop_back();
+            
+            if (current == t) {
+                vector<int> path = reconstructPath(labels.parent, s, t);
+                result.path = view.toCodes(path);
+                result.stops = path.size() - 1;
+                result.totalDistance = view.pathDistance(path);
+                result.found = true;
                 return result;
             }
             
-            // Gunakan set untuk avoid duplicate neighbors
-            set<string> uniqueNeighbors;
-            for (const Route& route : adjacencyList[current]) {
-                uniqueNeighbors.insert(route.destination);
+            // Baris CSR sudah unik dan terurut per kode, tidak perlu set lagi
+            for (int e = g.edgeBegin(current); e < g.edgeEnd(current); e++) {
+                int neighbor = g.targets[e];
+                if (!labels.reached(neighbor)) {
+                    labels.set(neighbor, 0, current);
+                    st.push_back(neighbor);
+                }
+            }
+        }
+        
+        result.found = false;
+        return result;
+    }
+    
+public:
+    // Wrapper untuk kompatibilitas dengan kode lama
+    vector<string> findPath(const string& start, const string& end, const string& method) const {
+        return findPath(AirportId::fromCode(start), AirportId::fromCode(end), method);
+    }
+    
+    vector<string> findPath(AirportId start, AirportId end, const string& method) const {
+        if (method == "BFS") {
+            return findPathBFS(start, end).path;
+        } else if (method == "DFS") {
+            return findPathDFS(start, end).path;
+        } else if (method == "DIJKSTRA") {
+            return findShortestPath(start, end).path;
+        }
+        return vector<string>();
+    }
+    
+    // ==================== DIJKSTRA - DENGAN RETURN PATHRESULT ====================
+    PathResult findShortestPath(const string& start, const string& end) const {
+        return findShortestPath(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findShortestPath(AirportId start, AirportId end) const {
+        return findShortestPath(start, end, threadWorkspace());
+    }
+    
+    PathResult findShortestPath(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        return cachedQuery(*view, start, end, QueryAlgorithm::DIJKSTRA, -1,
+                           [&]() { return computeShortestPath(*view, start, end, workspace); });
+    }
+    
+    /**
+     * findShortestPath - Dijkstra dengan policy priority queue pilihan
+     * @param pq: NodeHeap, RadixHeapQueue, DialQueue, atau QuaternaryHeapQueue
+     */
+    template <typename Queue>
+    PathResult findShortestPath(AirportId start, AirportId end, SearchWorkspace& workspace, Queue& pq) const {
+        return computeShortestPath(*snapshot(), start, end, workspace, pq);
+    }
+
+private:
+    // Dijkstra di snapshot view, dijawab dari tree hub jika asal atau tujuan hub
+    PathResult computeShortestPath(const GraphSnapshot& view, AirportId start, AirportId end,
+                                   SearchWorkspace& workspace) const {
+        PathResult fromHub;
+        if (findShortestPathFromHubTrees(view, start, end, fromHub)) {
+            return fromHub;
+        }
+        return computeShortestPath(view, start, end, workspace, workspace.heapForward);
+    }
+    
+    template <typename Queue>
+    PathResult computeShortestPath(const GraphSnapshot& view, AirportId start, AirportId end,
+                                   SearchWorkspace& workspace, Queue& pq) const {
+        PathResult result;
+        result.algorithm = "Dijkstra (Shortest Path)";
+        
+        int s = view.vertexId(start);
+        int t = view.vertexId(end);
+        if (s == -1 || t == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        const CSRGraph& g = *view.csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;
+        result.expandedNodes = dijkstraSearch(g, s, t, labels, pq);
+        
+        if (!labels.reached(t)) {
+            result.found = false;
+            return result;
+        }
+        
+        result.path = view.toCodes(reconstructPath(labels.parent, s, t));
+        result.stops = result.path.size() - 1;
+        result.totalDistance = labels.dist[t];
+        result.found = true;
+        
+        return result;
+    }
+    
+public:
+    // ==================== BIDIRECTIONAL DIJKSTRA ====================
+    
+    /**
+     * findShortestPathBidirectional - Dijkstra dua arah untuk query point-to-point
+     * Maju dari asal lewat edge keluar, mundur dari tujuan lewat edge masuk (reverse CSR).
+     * Berhenti saat top(maju) + top(mundur) >= jarak terbaik yang sudah bertemu (mu).
+     * @return: PathResult dengan jarak yang sama dengan findShortestPath
+     */
+    PathResult findShortestPathBidirectional(const string& start, const string& end) const {
+        return findShortestPathBidirectional(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findShortestPathBidirectional(AirportId start, AirportId end) const {
+        return findShortestPathBidirectional(start, end, threadWorkspace());
+    }
+    
+    PathResult findShortestPathBidirectional(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        PathResult result;
+        result.algorithm = "Bidirectional Dijkstra";
+        
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        const CSRGraph& g = *view->csr;
+        const int INF = numeric_limits<int>::max();
+        workspace.prepare(g.numVertices());
+        SearchLabels& labelsForward = workspace.forward;
+        SearchLabels& labelsBackward = workspace.backward;
+        NodeHeap& pqForward = workspace.heapForward;
+        NodeHeap& pqBackward = workspace.heapBackward;
+        
+        labelsForward.set(s, 0, -1);
+        labelsBackward.set(t, 0, -1);
+        pqForward.push(NodeDistance(s, 0));
+        pqBackward.push(NodeDistance(t, 0));
+        
+        int best = (s == t) ? 0 : INF;   // mu: jarak terbaik lewat titik temu
+        int meet = (s == t) ? s : -1;
+        
+        while (!pqForward.empty() && !pqBackward.empty()) {
+            if (pqForward.top().distance + pqBackward.top().distance >= best) {
+                break;
+            }
+            
+            // Expand sisi dengan key terkecil
+            bool forward = pqForward.top().distance <= pqBackward.top().distance;
+            NodeHeap& pq = forward ? pqForward : pqBackward;
+            SearchLabels& labels = forward ? labelsForward : labelsBackward;
+            const SearchLabels& other = forward ? labelsBackward : labelsForward;
+            const CSRArray<int>& offsets = forward ? g.offsets : g.inOffsets;
+            const CSRArray<int>& neighbors = forward ? g.targets : g.inSources;
+            const CSRArray<int>& weights = forward ? g.weights : g.inWeights;
+            
+            NodeDistance current = pq.top();
+            pq.pop();
+            int u = current.vertex;
+            if (current.distance > labels.dist[u]) {
+                continue;
+            }
+            result.expandedNodes++;
+            
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = neighbors[e];
+                int alt = current.distance + weights[e];
+                
+                if (alt < labels.distance(v)) {
+                    labels.set(v, alt, u);
+                    pq.push(NodeDistance(v, alt));
+                    
+                    // Cek titik temu dengan pencarian arah lain
+                    if (other.reached(v) && alt + other.dist[v] < best) {
+                        best = alt + other.dist[v];
+                        meet = v;
+                    }
+                }
+            }
+        }
+        
+        if (meet == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        // Gabungkan path: asal -> meet (parent maju), meet -> tujuan (parent mundur)
+        vector<int> path = reconstructPath(labelsForward.parent, s, meet);
+        for (int v = meet; v != t; ) {
+            v = labelsBackward.parent[v];
+            path.push_back(v);
+        }
+        
+        result.path = view->toCodes(path);
+        result.stops = path.size() - 1;
+        result.totalDistance = best;
+        result.found = true;
+        
+        return result;
+    }
+    
+    // ==================== A* (GREAT-CIRCLE HEURISTIC) ====================
+    
+private:
+    /**
+     * aStarSearch - A* generik di atas CSR, dipakai oleh A* great-circle dan ALT
+     * @param heuristicFn: Lower bound jarak v -> t (harus admissible dan konsisten)
+     * @return: PathResult lengkap dengan expandedNodes
+     */
+    template <typename Heuristic>
+    PathResult aStarSearch(const GraphSnapshot& view, int s, int t, const string& algorithm,
+                           SearchWorkspace& workspace, Heuristic heuristicFn) const {
+        PathResult result;
+        result.algorithm = algorithm;
+        
+        const CSRGraph& g = *view.csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;   // extra[v] = h(v), dihitung saat v pertama dicapai
+        NodeHeap& pq = workspace.heapForward;
+        
+        labels.set(s, 0, -1);
+        labels.extra[s] = heuristicFn(s);
+        pq.push(NodeDistance(s, labels.extra[s]));
+        
+        while (!pq.empty()) {
+            NodeDistance current = pq.top();
+            pq.pop();
+            
+            int u = current.vertex;
+            if (current.distance > labels.dist[u] + labels.extra[u]) {
+                continue;
+            }
+            result.expandedNodes++;
+            
+            if (u == t) {
+                break;
+            }
+            
+            for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                int v = g.targets[e];
+                int alt = labels.dist[u] + g.weights[e];
+                
+                if (alt < labels.distance(v)) {
+                    bool firstVisit = !labels.reached(v);
+                    labels.set(v, alt, u);
+                    if (firstVisit) {
+                        labels.extra[v] = heuristicFn(v);
+                    }
+                    pq.push(NodeDistance(v, alt + labels.extra[v]));
+                }
+            }
+        }
+        
+        if (!labels.reached(t)) {
+            result.found = false;
+            return result;
+        }
+        
+        result.path = view.toCodes(reconstructPath(labels.parent, s, t));
+        result.stops = result.path.size() - 1;
+        result.totalDistance = labels.dist[t];
+        result.found = true;
+        
+        return result;
+    }
+    
+    // A* dengan heuristic great-circle h(v) = floor(scale * greatCircle(v, t))
+    PathResult greatCircleSearch(const GraphSnapshot& view, int s, int t, const string& algorithm,
+                                 SearchWorkspace& workspace) const {
+        const CSRGraph& g = *view.csr;
+        return aStarSearch(view, s, t, algorithm, workspace, [&g, t](int v) {
+            return (int)floor(g.heuristicScale * g.greatCircle(v, t));
+        });
+    }
+
+public:
+    
+    /**
+     * findShortestPathAStar - Dijkstra dengan heuristic jarak great-circle ke tujuan
+     * Priority queue diurutkan berdasarkan f = g + h, h(v) = floor(scale * greatCircle(v, tujuan)).
+     * Heuristic admissible dan konsisten, jadi setiap node cukup di-settle sekali.
+     * @return: PathResult dengan jarak yang sama dengan findShortestPath
+     */
+    PathResult findShortestPathAStar(const string& start, const string& end) const {
+        return findShortestPathAStar(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findShortestPathAStar(AirportId start, AirportId end) const {
+        return findShortestPathAStar(start, end, threadWorkspace());
+    }
+    
+    PathResult findShortestPathAStar(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1) {
+            PathResult result;
+            result.algorithm = "A* (Great-Circle Heuristic)";
+            return result;
+        }
+        
+        return greatCircleSearch(*view, s, t, "A* (Great-Circle Heuristic)", workspace);
+    }
+    
+    // ==================== ALT (LANDMARK) ====================
+    
+    /**
+     * setLandmarkCount - Atur jumlah landmark ALT (berlaku saat build berikutnya)
+     * @param count: Jumlah landmark (1-64)
+     */
+    void setLandmarkCount(int count) {
+        landmarkCount = max(1, min(count, 64));
+    }
+    
+    /**
+     * buildLandmarks - Bangun tabel landmark secara sinkron dan tampilkan statistik
+     * Menunggu rebuild background yang sedang berjalan jika ada.
+     */
+    void buildLandmarks() const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        shared_ptr<const LandmarkTables> tables = waitForLandmarks(view->csr);
+        if (!tables) {
+            return;
+        }
+        
+        cout << "✓ Landmark ALT: " << tables->numLandmarks << " landmark (";
+        for (int k = 0; k < tables->numLandmarks; k++) {
+            cout << (k > 0 ? " " : "") << view->airportIds[tables->landmarks[k]].toCode();
+        }
+        cout << "), " << fixed << setprecision(1) << tables->buildMillis << " ms" << endl;
+    }
+    
+    /**
+     * findShortestPathALT - A* dengan lower bound landmark (triangle inequality)
+     * h(v) = max over L dari max(d(L,t) - d(L,v), d(v,L) - d(t,L)), konsisten sehingga
+     * hasil sama dengan Dijkstra. Selama tabel dibangun ulang di background (setelah
+     * addEdge/removeEdge), query memakai heuristic great-circle agar tetap benar.
+     * @return: PathResult dengan jarak yang sama dengan findShortestPath
+     */
+    PathResult findShortestPathALT(const string& start, const string& end) const {
+        return findShortestPathALT(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findShortestPathALT(AirportId start, AirportId end) const {
+        return findShortestPathALT(start, end, threadWorkspace());
+    }
+    
+    PathResult findShortestPathALT(AirportId start, AirportId end, SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1) {
+            // Cek sebelum currentLandmarks() supaya kode tidak dikenal tidak memicu build landmark
+            PathResult result;
+            result.algorithm = "ALT (Landmark, bandara tidak dikenal)";
+            return result;
+        }
+        
+        shared_ptr<const LandmarkTables> tables = currentLandmarks(view->csr);
+        if (!tables) {
+            return greatCircleSearch(*view, s, t, "ALT (fallback A* great-circle, landmark sedang dibangun)",
+                                     workspace);
+        }
+        
+        const int INF = numeric_limits<int>::max();
+        const int K = tables->numLandmarks;
+        const int* fromTarget = tables->fromLandmark.data() + (size_t)t * K;
+        const int* toTarget = tables->toLandmark.data() + (size_t)t * K;
+        
+        return aStarSearch(*view, s, t, "ALT (Landmark, K=" + to_string(K) + ")", workspace, [&](int v) {
+            const int* fromV = tables->fromLandmark.data() + (size_t)v * K;
+            const int* toV = tables->toLandmark.data() + (size_t)v * K;
+            int bound = 0;
+            for (int k = 0; k < K; k++) {
+                // Suku dengan jarak INF tidak memberi informasi, dilewati
+                if (fromTarget[k] != INF && fromV[k] != INF) {
+                    bound = max(bound, fromTarget[k] - fromV[k]);
+                }
+                if (toV[k] != INF && toTarget[k] != INF) {
+                    bound = max(bound, toV[k] - toTarget[k]);
+                }
+            }
+            return bound;
+        });
+    }
+    
+    /**
+     * saveLandmarks - Simpan tabel landmark ke file biner (.lmk)
+     * @return: false jika tabel belum siap atau file gagal ditulis
+     */
+    bool saveLandmarks(const string& filename) const {
+        shared_ptr<const LandmarkTables> tables = currentLandmarks(snapshot()->csr);
+        if (!tables) {
+            cerr << "Error: Tabel landmark belum siap" << endl;
+            return false;
+        }
+        
+        LandmarkFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, LANDMARK_MAGIC, sizeof(header.magic));
+        header.version = LANDMARK_VERSION;
+        header.endianCheck = SNAPSHOT_ENDIAN_CHECK;
+        header.numVertices = tables->source->numVertices();
+        header.numLandmarks = tables->numLandmarks;
+        header.graphFingerprint = graphFingerprint(*tables->source);
+        
+        string payload;
+        payload.append((const char*)tables->landmarks.data(), tables->landmarks.size() * sizeof(int32_t));
+        payload.append((const char*)tables->fromLandmark.data(), tables->fromLandmark.size() * sizeof(int32_t));
+        payload.append((const char*)tables->toLandmark.data(), tables->toLandmark.size() * sizeof(int32_t));
+        header.checksum = computeChecksum(payload.data(), payload.size());
+        
+        string tempFile = filename + ".tmp";
+        {
+            ofstream out(tempFile, ios::binary | ios::trunc);
+            if (!out.is_open()) {
+                cerr << "Error: Tidak dapat menulis file landmark " << filename << endl;
+                return false;
+            }
+            out.write((const char*)&header, sizeof(header));
+            out.write(payload.data(), payload.size());
+            if (!out.good()) {
+                cerr << "Error: Gagal menulis file landmark " << filename << endl;
+                return false;
+            }
+        }
+        
+        error_code ec;
+        filesystem::rename(tempFile, filename, ec);
+        if (ec) {
+            cerr << "Error: Gagal menyimpan file landmark " << filename << ": " << ec.message() << endl;
+            filesystem::remove(tempFile, ec);
+            return false;
+        }
+        return true;
+    }
+    
+    /**
+     * loadLandmarks - Muat tabel landmark dari file biner
+     * @return: false jika file tidak ada, rusak, atau dibuat dari graph yang berbeda
+     */
+    bool loadLandmarks(const string& filename) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            return false;
+        }
+        
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        LandmarkFileHeader header;
+        if (file.size() < sizeof(header)) {
+            cerr << "Warning: File landmark " << filename << " tidak valid" << endl;
+            return false;
+        }
+        memcpy(&header, file.data(), sizeof(header));
+        
+        size_t K = header.numLandmarks;
+        size_t n = header.numVertices;
+        size_t payloadSize = (K + 2 * n * K) * sizeof(int32_t);
+        if (memcmp(header.magic, LANDMARK_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != LANDMARK_VERSION || header.endianCheck != SNAPSHOT_ENDIAN_CHECK ||
+            file.size() - sizeof(header) != payloadSize) {
+            cerr << "Warning: File landmark " << filename << " tidak valid / versi berbeda" << endl;
+            return false;
+        }
+        if (n != (size_t)g.numVertices() || header.graphFingerprint != graphFingerprint(g)) {
+            cerr << "Warning: File landmark " << filename << " dibuat dari graph lain, bangun ulang" << endl;
+            return false;
+        }
+        const char* payload = file.data() + sizeof(header);
+        if (computeChecksum(payload, payloadSize) != header.checksum) {
+            cerr << "Warning: Checksum file landmark " << filename << " tidak cocok" << endl;
+            return false;
+        }
+        
+        shared_ptr<LandmarkTables> tables = make_shared<LandmarkTables>();
+        tables->source = view->csr;
+        tables->numLandmarks = K;
+        const int32_t* values = (const int32_t*)payload;
+        tables->landmarks.assign(values, values + K);
+        tables->fromLandmark.assign(values + K, values + K + n * K);
+        tables->toLandmark.assign(values + K + n * K, values + K + 2 * n * K);
+        
+        lock_guard<mutex> lock(landmarkMutex);
+        landmarkCache = tables;
+        return true;
+    }
+    
+    // ==================== QUERY KONKUREN ====================
+    
+    /**
+     * prepareConcurrentQueries - Bangun cache turunan snapshot sebelum query dari banyak thread
+     * Query tetap benar tanpa ini, tapi worker pertama tidak perlu menunggu build CH/landmark.
+     * @param needCH: Bangun contraction hierarchy
+     * @param needLandmarks: Tunggu tabel landmark ALT siap
+     */
+    void prepareConcurrentQueries(bool needCH, bool needLandmarks) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        if (needCH) {
+            contractionHierarchy(view->csr);
+        }
+        if (needLandmarks) {
+            waitForLandmarks(view->csr);
+        }
+    }
+    
+    /**
+     * randomAirportPairs - Pasangan bandara acak untuk benchmark/verifikasi
+     * @param seed: Seed tetap agar hasil bisa diulang
+     */
+    vector<pair<AirportId, AirportId>> randomAirportPairs(int count, unsigned seed) const {
+        vector<pair<AirportId, AirportId>> pairs;
+        if (airportIds.empty()) {
+            return pairs;
+        }
+        mt19937 rng(seed);
+        uniform_int_distribution<int> pick(0, (int)airportIds.size() - 1);
+        for (int i = 0; i < count; i++) {
+            AirportId a = airportIds[pick(rng)];
+            AirportId b = airportIds[pick(rng)];
+            pairs.push_back({a, b});
+        }
+        return pairs;
+    }
+    
+    // Semua bandara (urut vertex ID), misalnya untuk distance matrix penuh
+    const vector<AirportId>& getAllAirportIds() const {
+        return airportIds;
+    }
+    
+    // ==================== SNAPSHOT MVCC ====================
+    
+    /**
+     * snapshot - Versi graph terakhir yang dipublikasikan (tanpa menunggu writer)
+     * Snapshot immutable dan tetap valid selama dipegang walaupun writer sudah
+     * mempublikasikan versi baru. Semua method query memakai fungsi ini.
+     * Jika graph diubah langsung (addEdge, removeEdge, load) dan tidak ada writer yang
+     * sedang berjalan, versi baru dipublikasikan di sini; jika applyUpdates sedang berjalan,
+     * reader tetap memakai versi terakhir (writer mempublikasikan saat batch selesai).
+     */
+    shared_ptr<const GraphSnapshot> snapshot() const {
+        shared_ptr<const GraphSnapshot> current = atomic_load(&publishedSnapshot);
+        if (current && current->version == graphVersion) {
+            return current;
+        }
+        unique_lock<mutex> lock(writerMutex, try_to_lock);
+        if (!lock.owns_lock()) {
+            if (current) {
+                return current;
+            }
+            lock.lock();   // Belum ada versi yang berlaku: tunggu publikasi writer
+        }
+        current = atomic_load(&publishedSnapshot);
+        return current && current->version == graphVersion ? current : publishSnapshotLocked();
+    }
+    
+    shared_ptr<const GraphSnapshot> publishSnapshot() {
+        lock_guard<mutex> lock(writerMutex);
+        return publishSnapshotLocked();
+    }
+    
+    /**
+     * applyUpdates - Terapkan batch mutasi rute lalu publikasikan SATU versi baru
+     * Writer saling menunggu lewat writerMutex, tapi tidak pernah menunggu reader:
+     * query yang sedang berjalan tetap memakai snapshot lama sampai selesai.
+     * @return: Jumlah update yang benar-benar mengubah graph
+     */
+    size_t applyUpdates(const vector<RouteUpdate>& batch) {
+        lock_guard<mutex> lock(writerMutex);
+        size_t applied = 0;
+        for (const RouteUpdate& update : batch) {
+            uint64_t before = graphVersion;
+            if (update.kind == RouteUpdate::ADD_ROUTE) {
+                addEdge(update.from, update.to, update.distance, update.airline);
+            } else {
+                removeEdge(update.from, update.to);
+            }
+            if (graphVersion != before) {
+                applied++;
+            }
+        }
+        publishSnapshotLocked();
+        return applied;
+    }
+
+private:
+    // Tabel rute per bandara -> format CSR (offsets + records)
+    static void flattenRoutes(const vector<vector<RouteRecord>>& table, vector<int>& offsets,
+                              vector<RouteRecord>& records) {
+        offsets.assign(table.size() + 1, 0);
+        for (size_t v = 0; v < table.size(); v++) {
+            offsets[v + 1] = offsets[v] + table[v].size();
+        }
+        records.clear();
+        records.reserve(offsets.back());
+        for (const vector<RouteRecord>& routes : table) {
+            records.insert(records.end(), routes.begin(), routes.end());
+        }
+    }
+    
+    // Bangun snapshot dari state saat ini (writerMutex harus dipegang)
+    shared_ptr<const GraphSnapshot> publishSnapshotLocked() const {
+        shared_ptr<GraphSnapshot> next = make_shared<GraphSnapshot>();
+        next->csr = (csr(), csrCache);
+        next->hubs = hubTrees() ? hubCache : nullptr;
+        next->version = graphVersion;
+        next->airportIds = airportIds;
+        next->idIndex = idIndex;
+        next->routeCount = totalRouteCount;
+        flattenRoutes(routeTable, next->routeOffsets, next->routes);
+        flattenRoutes(incomingTable, next->incomingOffsets, next->incomingRoutes);
+        next->airlineNames = airlineNames;
+        
+        shared_ptr<const GraphSnapshot> published = next;
+        atomic_store(&publishedSnapshot, published);
+        return published;
+    }
+
+public:
+    /**
+     * benchmarkSnapshotUpdates - Latensi batch update dengan dan tanpa reader konkuren
+     * Writer menambah lalu menghapus rute sintetis (graph kembali seperti semula),
+     * reader menjalankan query Dijkstra terus-menerus di snapshot terbaru.
+     * @param readerThreads: Jumlah thread reader
+     */
+    void benchmarkSnapshotUpdates(int readerThreads) {
+        shared_ptr<const GraphSnapshot> base = publishSnapshot();
+        const CSRGraph& g = *base->csr;
+        if (g.numVertices() < 2) {
+            cout << "Graph kosong!" << endl;
+            return;
+        }
+        
+        // Rute sintetis: pasangan bandara yang belum terhubung langsung
+        const int BATCH_SIZE = 40;
+        const int ROUNDS = 25;
+        vector<RouteUpdate> addBatch, removeBatch;
+        for (const auto& pair : randomAirportPairs(BATCH_SIZE * 4, 4242)) {
+            int u = getVertexId(pair.first);
+            int v = getVertexId(pair.second);
+            if (u == v || g.findEdge(u, v) != -1 || (int)addBatch.size() == BATCH_SIZE) {
+                continue;
+            }
+            bool duplicate = false;
+            for (const RouteUpdate& update : addBatch) {
+                duplicate = duplicate || (update.from == pair.first && update.to == pair.second);
+            }
+            if (!duplicate) {
+                addBatch.push_back(RouteUpdate::add(pair.first, pair.second, max(1, (int)g.greatCircle(u, v)), "SIM"));
+                removeBatch.push_back(RouteUpdate::remove(pair.first, pair.second));
+            }
+        }
+        vector<pair<AirportId, AirportId>> queries = randomAirportPairs(2000, 99);
+        
+        auto runUpdates = [&](double& avgMillis, double& maxMillis) {
+            avgMillis = maxMillis = 0;
+            for (int round = 0; round < ROUNDS; round++) {
+                for (const vector<RouteUpdate>* batch : {&addBatch, &removeBatch}) {
+                    auto startTime = chrono::steady_clock::now();
+                    applyUpdates(*batch);
+                    double millis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+                    avgMillis += millis;
+                    maxMillis = max(maxMillis, millis);
+                }
+            }
+            avgMillis /= ROUNDS * 2;
+        };
+        
+        double idleAvg, idleMax;
+        runUpdates(idleAvg, idleMax);
+        
+        // Reader: query terus-menerus, cek versi snapshot yang dilihat tidak pernah mundur
+        atomic<bool> stop(false);
+        atomic<long long> totalQueries(0);
+        atomic<int> versionRegressions(0);
+        vector<uint64_t> versionsSeen(readerThreads, 0);
+        vector<thread> readers;
+        for (int r = 0; r < readerThreads; r++) {
+            readers.emplace_back([&, r]() {
+                SearchWorkspace workspace;
+                uint64_t lastVersion = 0;
+                size_t index = r;
+                long long count = 0;
+                set<uint64_t> seen;
+                while (!stop.load(memory_order_relaxed)) {
+                    shared_ptr<const GraphSnapshot> current = snapshot();
+                    if (current->version < lastVersion) {
+                        versionRegressions++;
+                    }
+                    lastVersion = current->version;
+                    seen.insert(lastVersion);
+                    const auto& query = queries[index++ % queries.size()];
+                    current->findShortestPath(query.first, query.second, workspace);
+                    count++;
+                }
+                totalQueries += count;
+                versionsSeen[r] = seen.size();
+            });
+        }
+        
+        auto startTime = chrono::steady_clock::now();
+        double busyAvg, busyMax;
+        runUpdates(busyAvg, busyMax);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        stop = true;
+        for (thread& reader : readers) {
+            reader.join();
+        }
+        
+        uint64_t maxVersionsSeen = 0;
+        for (uint64_t seen : versionsSeen) {
+            maxVersionsSeen = max(maxVersionsSeen, seen);
+        }
+        
+        cout << "\n" << string(80, '=') << endl;
+        cout << "        SNAPSHOT MVCC: " << ROUNDS * 2 << " batch x " << addBatch.size()
+             << " rute, " << readerThreads << " reader" << endl;
+        cout << string(80, '=') << endl;
+        cout << fixed << setprecision(2);
+        cout << "Latensi batch tanpa reader   : rata-rata " << idleAvg << " ms, maks " << idleMax << " ms" << endl;
+        cout << "Latensi batch dengan reader  : rata-rata " << busyAvg << " ms, maks " << busyMax << " ms" << endl;
+        cout << "Throughput reader            : " << setprecision(0) << (totalQueries / max(seconds, 1e-9))
+             << " query/detik (" << totalQueries << " query)" << endl;
+        cout << "Versi berbeda dilihat reader : " << maxVersionsSeen << " (versi mundur: " << versionRegressions << ")" << endl;
+        cout << "Versi graph sekarang         : " << graphVersion << ", rute " << totalRouteCount
+             << (totalRouteCount == base->routeCount ? " (kembali seperti semula)" : "") << endl;
+        cout << string(80, '=') << endl;
+    }
+    
+    // ==================== DISTANCE MATRIX ====================
+
+private:
+    /**
+     * singleSourceSearch - Dijkstra penuh dari s tanpa early exit
+     * Label diurutkan (jarak, stops): extra[v] = jumlah stops rute terpendek dengan stops paling sedikit.
+     */
+    void singleSourceSearch(const CSRGraph& g, int s, SearchWorkspace& workspace) const {
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;
+        
+        // Kunci heap (jarak, stops) leksikografis, dipack jadi satu int64 (stops < 2^16 karena
+        // V <= AIRPORT_ID_SPACE). Kunci naik ketat di setiap edge, termasuk edge 0 km, jadi label
+        // vertex yang sudah di-settle tidak pernah ditulis ulang setelah turunannya membacanya.
+        auto packKey = [](int dist, int stops) { return ((int64_t)dist << 16) | stops; };
+        vector<pair<int64_t, int>>& pq = workspace.keyedHeap;
+        auto push = [&pq](int64_t key, int v) {
+            pq.push_back({key, v});
+            push_heap(pq.begin(), pq.end(), greater<pair<int64_t, int>>());
+        };
+        
+        labels.set(s, 0, -1);
+        labels.extra[s] = 0;
+        push(packKey(0, 0), s);
+        
+        while (!pq.empty()) {
+            pop_heap(pq.begin(), pq.end(), greater<pair<int64_t, int>>());
+            int64_t key = pq.back().first;
+            int u = pq.back().second;
+            pq.pop_back();
+            if (key != packKey(labels.dist[u], labels.extra[u])) {
+                continue;
+            }
+            
+            for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                int v = g.targets[e];
+                int alt = labels.dist[u] + g.weights[e];
+                int nextStops = labels.extra[u] + 1;
+                
+                if (!labels.reached(v) || packKey(alt, nextStops) < packKey(labels.dist[v], labels.extra[v])) {
+                    labels.set(v, alt, u);
+                    labels.extra[v] = nextStops;
+                    push(packKey(alt, nextStops), v);
+                }
+            }
+        }
+    }
+    
+    /**
+     * computeMatrixRows - Isi baris [rowBegin, rowEnd) secara paralel (satu SSSP per baris)
+     * Baris r ditulis ke distOut/stopsOut mulai offset (r - rowBegin) * targetIds.size().
+     */
+    void computeMatrixRows(const CSRGraph& g, const vector<int>& sourceIds, const vector<int>& targetIds,
+                           size_t rowBegin, size_t rowEnd, int32_t* distOut, int16_t* stopsOut,
+                           int numThreads) const {
+        size_t cols = targetIds.size();
+        atomic<size_t> nextRow(rowBegin);
+        auto worker = [&]() {
+            SearchWorkspace workspace;
+            while (true) {
+                size_t row = nextRow.fetch_add(1);
+                if (row >= rowEnd) {
+                    break;
+                }
+                int32_t* distRow = distOut + (row - rowBegin) * cols;
+                int16_t* stopsRow = stopsOut + (row - rowBegin) * cols;
+                int s = sourceIds[row];
+                if (s == -1) {
+                    fill(distRow, distRow + cols, -1);
+                    fill(stopsRow, stopsRow + cols, -1);
+                    continue;
+                }
+                
+                singleSourceSearch(g, s, workspace);
+                const SearchLabels& labels = workspace.forward;
+                for (size_t col = 0; col < cols; col++) {
+                    int t = targetIds[col];
+                    bool reached = t != -1 && labels.reached(t);
+                    distRow[col] = reached ? labels.dist[t] : -1;
+                    stopsRow[col] = reached ? (int16_t)labels.extra[t] : -1;
+                }
+            }
+        };
+        
+        int workers = (int)min<size_t>(numThreads, rowEnd - rowBegin);
+        if (workers <= 1) {
+            worker();
+            return;
+        }
+        vector<thread> pool;
+        for (int i = 0; i < workers; i++) {
+            pool.emplace_back(worker);
+        }
+        for (thread& t : pool) {
+            t.join();
+        }
+    }
+    
+    int resolveThreads(int threads) const {
+        return threads > 0 ? threads : (int)max(1u, thread::hardware_concurrency());
+    }
+
+public:
+    /**
+     * computeDistanceMatrix - Matriks jarak + stops dari setiap sources ke setiap targets
+     * Satu Dijkstra penuh per source, dijalankan paralel antar source.
+     * @param threads: Jumlah thread, 0 = otomatis
+     * @return: DistanceMatrix row-major (bandara tidak dikenal menghasilkan baris/kolom -1)
+     */
+    DistanceMatrix computeDistanceMatrix(const vector<AirportId>& sources, const vector<AirportId>& targets,
+                                         int threads = 0) const {
+        DistanceMatrix matrix;
+        matrix.sources = sources;
+        matrix.targets = targets;
+        matrix.distances.resize(sources.size() * targets.size());
+        matrix.stops.resize(sources.size() * targets.size());
+        
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        vector<int> sourceIds, targetIds;
+        for (AirportId a : sources) sourceIds.push_back(view->vertexId(a));
+        for (AirportId a : targets) targetIds.push_back(view->vertexId(a));
+        
+        computeMatrixRows(*view->csr, sourceIds, targetIds, 0, sources.size(),
+                          matrix.distances.data(), matrix.stops.data(), resolveThreads(threads));
+        return matrix;
+    }
+    
+    /**
+     * writeDistanceMatrix - Hitung matriks dan stream langsung ke file biner per blok baris
+     * Memori yang dipakai hanya satu blok (bukan seluruh matriks), cocok untuk 6k x 6k.
+     * @return: false jika file gagal ditulis
+     */
+    bool writeDistanceMatrix(const string& filename, const vector<AirportId>& sources,
+                             const vector<AirportId>& targets, int threads = 0) const {
+        ofstream out(filename, ios::binary | ios::trunc);
+        if (!out.is_open()) {
+            cerr << "Error: Tidak dapat menulis file " << filename << endl;
+            return false;
+        }
+        
+        MatrixFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, MATRIX_MAGIC, sizeof(header.magic));
+        header.version = MATRIX_VERSION;
+        header.endianCheck = SNAPSHOT_ENDIAN_CHECK;
+        header.numSources = sources.size();
+        header.numTargets = targets.size();
+        out.write((const char*)&header, sizeof(header));
+        
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        vector<int> sourceIds, targetIds;
+        vector<uint16_t> codes;
+        for (AirportId a : sources) {
+            sourceIds.push_back(view->vertexId(a));
+            codes.push_back(a.value);
+        }
+        for (AirportId a : targets) {
+            targetIds.push_back(view->vertexId(a));
+            codes.push_back(a.value);
+        }
+        out.write((const char*)codes.data(), codes.size() * sizeof(uint16_t));
+        
+        int numThreads = resolveThreads(threads);
+        size_t cols = targets.size();
+        size_t blockRows = max<size_t>(64, numThreads * 16);
+        vector<int32_t> distBlock(blockRows * cols);
+        vector<int16_t> stopsBlock(blockRows * cols);
+        for (size_t rowBegin = 0; rowBegin < sources.size(); rowBegin += blockRows) {
+            size_t rowEnd = min(sources.size(), rowBegin + blockRows);
+            computeMatrixRows(*view->csr, sourceIds, targetIds, rowBegin, rowEnd,
+                              distBlock.data(), stopsBlock.data(), numThreads);
+            for (size_t r = 0; r < rowEnd - rowBegin; r++) {
+                out.write((const char*)(distBlock.data() + r * cols), cols * sizeof(int32_t));
+                out.write((const char*)(stopsBlock.data() + r * cols), cols * sizeof(int16_t));
+            }
+            if (!out.good()) {
+                cerr << "Error: Gagal menulis file " << filename << endl;
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    // ==================== BIT-PARALLEL BFS (HOP MATRIX) ====================
+
+private:
+    /**
+     * bitParallelBFS - BFS untuk sampai 64 source sekaligus, satu bit per source
+     * seen[v] / frontier[v] adalah bitmask source yang sudah / baru mencapai v. Satu sweep
+     * per level: frontier di-OR ke semua tetangga, bit yang belum pernah terlihat menjadi
+     * frontier berikutnya dan jarak hop-nya dicatat.
+     * @param hopRows: Baris hop matrix untuk source pertama batch (stride = jumlah vertex)
+     */
+    void bitParallelBFS(const CSRGraph& g, const int* batchSources, int batchSize, uint8_t* hopRows,
+                        vector<uint64_t>& seen, vector<uint64_t>& frontier, vector<uint64_t>& next) const {
+        int n = g.numVertices();
+        seen.assign(n, 0);
+        frontier.assign(n, 0);
+        next.resize(n);
+        fill(hopRows, hopRows + (size_t)batchSize * n, HOP_UNREACHABLE);
+        
+        for (int b = 0; b < batchSize; b++) {
+            int s = batchSources[b];
+            if (s == -1) {
+                continue;
+            }
+            seen[s] |= 1ULL << b;
+            frontier[s] |= 1ULL << b;
+            hopRows[(size_t)b * n + s] = 0;
+        }
+        
+        bool active = true;
+        for (int level = 1; active && level < HOP_UNREACHABLE; level++) {
+            fill(next.begin(), next.end(), 0);
+            for (int u = 0; u < n; u++) {
+                uint64_t bits = frontier[u];
+                if (bits == 0) {
+                    continue;
+                }
+                for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                    next[g.targets[e]] |= bits;
+                }
+            }
+            
+            active = false;
+            for (int v = 0; v < n; v++) {
+                uint64_t newBits = next[v] & ~seen[v];
+                frontier[v] = newBits;
+                if (newBits == 0) {
+                    continue;
+                }
+                active = true;
+                seen[v] |= newBits;
+                while (newBits != 0) {
+                    int b = lowestBitIndex(newBits);
+                    hopRows[(size_t)b * n + v] = (uint8_t)level;
+                    newBits &= newBits - 1;
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * computeHopMatrix - Matriks stops minimum dari sources ke semua bandara
+     * Source diproses per batch 64 (satu uint64 per vertex) dengan bitParallelBFS,
+     * batch dibagi ke beberapa thread.
+     * @param threads: Jumlah thread, 0 = otomatis
+     * @return: HopMatrix beserta histogram jarak hop
+     */
+    HopMatrix computeHopMatrix(const vector<AirportId>& sources, int threads = 0) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        int n = g.numVertices();
+        
+        HopMatrix matrix;
+        matrix.sources = sources;
+        matrix.targets = view->airportIds;
+        matrix.hops.resize(sources.size() * (size_t)n);
+        
+        vector<int> sourceIds;
+        for (AirportId a : sources) {
+            sourceIds.push_back(view->vertexId(a));
+        }
+        
+        const size_t BATCH = 64;
+        size_t numBatches = (sources.size() + BATCH - 1) / BATCH;
+        atomic<size_t> nextBatch(0);
+        auto worker = [&]() {
+            vector<uint64_t> seen, frontier, next;
+            while (true) {
+                size_t batch = nextBatch.fetch_add(1);
+                if (batch >= numBatches) {
+                    break;
+                }
+                size_t first = batch * BATCH;
+                int batchSize = (int)min(BATCH, sources.size() - first);
+                bitParallelBFS(g, sourceIds.data() + first, batchSize, matrix.hops.data() + first * n,
+                               seen, frontier, next);
+            }
+        };
+        
+        int workers = (int)min<size_t>(resolveThreads(threads), numBatches);
+        if (workers <= 1) {
+            worker();
+        } else {
+            vector<thread> pool;
+            for (int i = 0; i < workers; i++) {
+                pool.emplace_back(worker);
+            }
+            for (thread& t : pool) {
+                t.join();
+            }
+        }
+        
+        // Histogram (pasangan asal == tujuan tidak dihitung)
+        matrix.histogram.assign(HOP_UNREACHABLE, 0);
+        for (size_t row = 0; row < sources.size(); row++) {
+            const uint8_t* hopRow = matrix.hops.data() + row * n;
+            for (int v = 0; v < n; v++) {
+                if (v == sourceIds[row]) {
+                    continue;
+                }
+                if (hopRow[v] == HOP_UNREACHABLE) {
+                    matrix.unreachablePairs++;
+                } else {
+                    matrix.histogram[hopRow[v]]++;
+                }
+            }
+        }
+        while (!matrix.histogram.empty() && matrix.histogram.back() == 0) {
+            matrix.histogram.pop_back();
+        }
+        return matrix;
+    }
+    
+    // ==================== HUB SHORTEST-PATH TREE CACHE ====================
+    
+    /**
+     * setHubAirports - Aktifkan cache shortest-path tree untuk bandara hub
+     * Tree dibangun saat query pertama (atau buildHubTrees) dan otomatis dibangun ulang
+     * setelah addEdge/removeEdge mengubah graph. Daftar kosong mematikan cache.
+     * @param codes: Kode bandara hub; kode yang tidak ada dilewati dengan warning
+     * @return: Jumlah hub yang dipakai
+     */
+    int setHubAirports(const vector<string>& codes) {
+        lock_guard<mutex> lock(writerMutex);
+        hubAirports.clear();
+        hubCache.reset();
+        pendingEdgeChanges.clear();
+        // Tree hub di snapshot lama tidak berlaku lagi, snapshot() berikutnya mempublikasikan ulang
+        atomic_store(&publishedSnapshot, shared_ptr<const GraphSnapshot>());
+        for (const string& code : codes) {
+            AirportId hub = AirportId::fromCode(code);
+            if (getVertexId(hub) == -1) {
+                cerr << "Warning: Hub " << code << " tidak ditemukan, dilewati" << endl;
+                continue;
+            }
+            if (find(hubAirports.begin(), hubAirports.end(), hub) == hubAirports.end()) {
+                hubAirports.push_back(hub);
             }
+        }
+        return hubAirports.size();
+    }
+    
+    /**
+     * busiestAirports - Bandara dengan jumlah rute (keluar + masuk) terbanyak
+     * @param count: Jumlah bandara
+     * @return: Kode bandara, terurut dari yang tersibuk
+     */
+    vector<string> busiestAirports(int count) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        vector<pair<int, int>> degrees;
+        for (int v = 0; v < g.numVertices(); v++) {
+            int degree = (g.edgeEnd(v) - g.edgeBegin(v)) + (g.inEdgeEnd(v) - g.inEdgeBegin(v));
+            degrees.push_back({-degree, v});
+        }
+        sort(degrees.begin(), degrees.end());
+        
+        vector<string> codes;
+        for (int i = 0; i < count && i < (int)degrees.size(); i++) {
+            codes.push_back(view->airportIds[degrees[i].second].toCode());
+        }
+        return codes;
+    }
+    
+    /**
+     * setHubTreeRepair - Pilih perbaikan inkremental (default) atau rebuild penuh tree hub
+     * setelah addEdge/removeEdge. Berguna untuk membandingkan biaya keduanya.
+     */
+    void setHubTreeRepair(bool enabled) {
+        hubRepairEnabled = enabled;
+    }
+    
+    bool hasHubAirports() const {
+        return !hubAirports.empty();
+    }
+    
+    /**
+     * buildHubTrees - Bangun (atau perbaiki) tree hub di depan dan tampilkan statistik
+     */
+    void buildHubTrees() const {
+        bool wasCurrent;
+        size_t pending;
+        {
+            lock_guard<mutex> lock(writerMutex);
+            wasCurrent = hubCache && hubCache->source == csrCache && !csrDirty;
+            pending = pendingEdgeChanges.size();
+        }
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const HubTrees* trees = view->hubs.get();
+        if (trees == nullptr) {
+            cout << "Cache hub tidak aktif (belum ada hub)" << endl;
+            return;
+        }
+        cout << fixed << setprecision(1);
+        if (!wasCurrent && pending > 0 && trees->repairedEdges == pending) {
+            cout << "✓ Tree hub diperbaiki inkremental: " << trees->repairedEdges << " edge berubah, "
+                 << trees->repairedVertices << " label vertex diperbarui (" << setprecision(2)
+                 << trees->repairMillis << " ms, rebuild penuh " << setprecision(1) << trees->buildMillis
+                 << " ms)" << endl;
+            return;
+        }
+        cout << "✓ Tree hub: " << trees->hubs.size() << " hub x 2 arah, "
+             << (trees->memoryBytes() / (1024.0 * 1024.0)) << " MB ("
+             << trees->buildMillis << " ms)" << endl;
+    }
+
+private:
+    /**
+     * findShortestPathFromHubTrees - Jawab query dari tree hub jika asal atau tujuan hub
+     * @param result: Diisi hasil (found=false jika tidak terhubung)
+     * @return: false jika cache tidak aktif atau query tidak menyentuh hub
+     */
+    bool findShortestPathFromHubTrees(const GraphSnapshot& view, AirportId start, AirportId end,
+                                      PathResult& result) const {
+        const HubTrees* trees = view.hubs.get();
+        int s = view.vertexId(start);
+        int t = view.vertexId(end);
+        if (trees == nullptr || s == -1 || t == -1) {
+            return false;
+        }
+        
+        vector<int> path;
+        int distance;
+        if (!hubTreePath(*trees, s, t, path, distance)) {
+            return false;
+        }
+        
+        result = PathResult();
+        result.algorithm = "Dijkstra (Hub Tree Cache)";
+        if (path.empty()) {
+            return true;
+        }
+        result.path = view.toCodes(path);
+        result.stops = path.size() - 1;
+        result.totalDistance = distance;
+        result.found = true;
+        return true;
+    }
+
+public:
+    // ==================== CACHE HASIL QUERY (LRU) ====================
+    
+    /**
+     * setResultCacheCapacity - Aktifkan cache LRU hasil query (BFS, DFS, Dijkstra, max stops)
+     * Kunci: (asal, tujuan, algoritma, batasan). Entry otomatis tidak berlaku setelah graph
+     * berubah (versi graph naik di setiap mutasi). Thread-safe untuk query paralel.
+     * @param capacity: Jumlah entry maksimum, 0 = matikan cache
+     */
+    void setResultCacheCapacity(size_t capacity) {
+        resultCache.setCapacity(capacity);
+    }
+    
+    QueryCacheStats getResultCacheStats() const {
+        return resultCache.stats();
+    }
+    
+    // Kosongkan cache dan reset counter hit/miss
+    void clearResultCache() {
+        resultCache.clear();
+    }
+    
+    uint64_t getGraphVersion() const {
+        return graphVersion;
+    }
+    
+    /**
+     * verifyResultCache - Cek hasil lewat cache sama dengan hasil tanpa cache
+     * Urutan panggilan sengaja diselang-seling (max stops -1 sebelum dan sesudah Dijkstra
+     * biasa, lalu BFS) sehingga kunci cache yang bertabrakan akan ketahuan.
+     * @param randomPairs: Jumlah pasangan acak (seed tetap)
+     * @return: Jumlah hasil yang tidak cocok
+     */
+    int verifyResultCache(int randomPairs) const {
+        auto sameResult = [](const PathResult& a, const PathResult& b) {
+            return a.found == b.found && (!a.found || (a.totalDistance == b.totalDistance && a.stops == b.stops));
+        };
+        
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        SearchWorkspace workspace;
+        int mismatches = 0;
+        for (const auto& pair : randomAirportPairs(randomPairs, 31)) {
+            AirportId a = pair.first;
+            AirportId b = pair.second;
+            PathResult dijkstra = computeShortestPath(*view, a, b, workspace, workspace.heapForward);
+            PathResult noStops = computeShortestPathWithMaxStops(*view, a, b, -1, workspace);
+            PathResult twoStops = computeShortestPathWithMaxStops(*view, a, b, 2, workspace);
+            PathResult bfs = computePathBFS(*view, a, b, workspace);
             
-            for (const string& neighbor : uniqueNeighbors) {
-                if (!visited[neighbor]) {
-                    visited[neighbor] = true;
-                    parent[neighbor] = current;
-                    q.push(neighbor);
+            bool ok = sameResult(findShortestPathWithMaxStops(a, b, -1), noStops) &&
+                      sameResult(findShortestPath(a, b), dijkstra) &&
+                      sameResult(findShortestPathWithMaxStops(a, b, -1), noStops) &&
+                      sameResult(findShortestPathWithMaxStops(a, b, 2), twoStops) &&
+                      sameResult(findPathBFS(a, b), bfs) &&
+                      sameResult(findShortestPath(a, b), dijkstra);
+            if (!ok) {
+                mismatches++;
+                if (mismatches <= 5) {
+                    cerr << "Cache tidak cocok: " << a.toCode() << " -> " << b.toCode() << endl;
                 }
             }
         }
-        
-        result.found = false;
-        return result;
+        cout << "Verifikasi cache vs tanpa cache: " << randomPairs << " pasangan acak, "
+             << mismatches << " tidak cocok" << endl;
+        return mismatches;
     }
     
-    // ==================== DFS - DENGAN RETURN PATHRESULT ====================
-    PathResult findPathDFS(const string& start, const string& end) {
+    // ==================== CONTRACTION HIERARCHIES ====================
+    
+    /**
+     * buildContractionHierarchy - Preprocessing CH secara eksplisit (offline)
+     * Query CH juga membangun hierarchy otomatis jika belum ada atau graph sudah berubah,
+     * fungsi ini untuk membangunnya di depan dan menampilkan statistik.
+     */
+    void buildContractionHierarchy() const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        shared_ptr<const ContractionHierarchy> ch = contractionHierarchy(view->csr);
+        cout << "✓ Contraction hierarchy: " << ch->numVertices() << " bandara, "
+             << view->csr->numEdges() << " edge asli, " << ch->shortcutCount << " shortcut ("
+             << fixed << setprecision(1) << ch->buildMillis << " ms)" << endl;
+    }
+    
+    /**
+     * findShortestPathCH - Query shortest path dengan Contraction Hierarchies
+     * Dijkstra dua arah yang hanya naik rank: maju lewat up edge dari asal,
+     * mundur lewat down edge dari tujuan. Path di-unpack menjadi rute bandara lengkap.
+     * @return: PathResult dengan jarak yang sama dengan findShortestPath
+     */
+    PathResult findShortestPathCH(const string& start, const string& end) const {
+        return findShortestPathCH(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    PathResult findShortestPathCH(AirportId start, AirportId end) const {
+        return findShortestPathCH(start, end, threadWorkspace());
+    }
+    
+    PathResult findShortestPathCH(AirportId start, AirportId end, SearchWorkspace& workspace) const {
         PathResult result;
-        result.algorithm = "DFS (Depth-First Search)";
+        result.algorithm = "Contraction Hierarchies";
         
-        if (vertexMap.find(start) == vertexMap.end() || 
-            vertexMap.find(end) == vertexMap.end()) {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1) {
             result.found = false;
             return result;
         }
         
-        unordered_map<string, string> parent;
-        unordered_map<string, bool> visited;
-        stack<string> s;
+        shared_ptr<const ContractionHierarchy> hierarchy = contractionHierarchy(view->csr);
+        const ContractionHierarchy& ch = *hierarchy;
+        const int INF = numeric_limits<int>::max();
+        workspace.prepare(ch.numVertices());
+        SearchLabels& labelsForward = workspace.forward;
+        SearchLabels& labelsBackward = workspace.backward;
+        NodeHeap& pqForward = workspace.heapForward;
+        NodeHeap& pqBackward = workspace.heapBackward;
+        
+        labelsForward.set(s, 0, -1);
+        labelsBackward.set(t, 0, -1);
+        pqForward.push(NodeDistance(s, 0));
+        pqBackward.push(NodeDistance(t, 0));
         
-        s.push(start);
-        visited[start] = true;
+        int best = (s == t) ? 0 : INF;
+        int meet = (s == t) ? s : -1;
         
-        while (!s.empty()) {
-            string current = s.top();
-            s.pop();
+        // Setiap arah berhenti sendiri saat key terkecilnya >= jarak terbaik
+        while (true) {
+            bool forwardActive = !pqForward.empty() && pqForward.top().distance < best;
+            bool backwardActive = !pqBackward.empty() && pqBackward.top().distance < best;
+            if (!forwardActive && !backwardActive) {
+                break;
+            }
+            bool forward = forwardActive &&
+                           (!backwardActive || pqForward.top().distance <= pqBackward.top().distance);
+            NodeHeap& pq = forward ? pqForward : pqBackward;
+            SearchLabels& labels = forward ? labelsForward : labelsBackward;
+            const SearchLabels& other = forward ? labelsBackward : labelsForward;
+            const vector<int>& offsets = forward ? ch.upOffsets : ch.downOffsets;
+            const vector<int>& neighbors = forward ? ch.upTargets : ch.downSources;
+            const vector<int>& weights = forward ? ch.upWeights : ch.downWeights;
             
-            if (current == end) {
-                result.path = reconstructPath(parent, start, end);
-                result.stops = result.path.size() - 1;
-                result.totalDistance = calculatePathDistance(result.path);
-                result.found = true;
-                return result;
+            NodeDistance current = pq.top();
+            pq.pop();
+            int u = current.vertex;
+            if (current.distance > labels.dist[u]) {
+                continue;
             }
+            result.expandedNodes++;
             
-            // Gunakan set untuk avoid duplicate neighbors
-            set<string> uniqueNeighbors;
-            for (const Route& route : adjacencyList[current]) {
-                uniqueNeighbors.insert(route.destination);
+            if (other.reached(u) && current.distance + other.dist[u] < best) {
+                best = current.distance + other.dist[u];
+                meet = u;
             }
             
-            for (const string& neighbor : uniqueNeighbors) {
-                if (!visited[neighbor]) {
-                    visited[neighbor] = true;
-                    parent[neighbor] = current;
-                    s.push(neighbor);
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = neighbors[e];
+                int alt = current.distance + weights[e];
+                if (alt < labels.distance(v)) {
+                    labels.set(v, alt, u);
+                    pq.push(NodeDistance(v, alt));
                 }
             }
         }
         
-        result.found = false;
+        if (meet == -1) {
+            result.found = false;
+            return result;
+        }
+        
+        // Path di hierarchy: asal -> meet (naik), meet -> tujuan (turun)
+        vector<int> hierarchyPath = reconstructPath(labelsForward.parent, s, meet);
+        for (int v = meet; v != t; ) {
+            v = labelsBackward.parent[v];
+            hierarchyPath.push_back(v);
+        }
+        
+        // Unpack shortcut menjadi edge asli
+        vector<int> path;
+        path.push_back(s);
+        for (size_t i = 0; i + 1 < hierarchyPath.size(); i++) {
+            ch.unpackEdge(hierarchyPath[i], hierarchyPath[i + 1], path);
+        }
+        
+        result.path = view->toCodes(path);
+        result.stops = path.size() - 1;
+        result.totalDistance = best;
+        result.found = true;
+        
         return result;
     }
     
-    // Wrapper untuk kompatibilitas dengan kode lama
-    vector<string> findPath(const string& start, const string& end, const string& method) {
-        if (method == "BFS") {
-            return findPathBFS(start, end).path;
-        } else if (method == "DFS") {
-            return findPathDFS(start, end).path;
-        } else if (method == "DIJKSTRA") {
-            return findShortestPath(start, end).path;
+    /**
+     * verifyContractionHierarchy - Cek query CH terhadap findShortestPath pada pasangan acak
+     * Jarak harus sama, dan path hasil unpack harus berupa rute valid dari asal ke tujuan
+     * dengan total jarak edge yang sama.
+     * @param randomPairs: Jumlah pasangan acak (seed tetap)
+     * @return: Jumlah pasangan yang tidak cocok
+     */
+    int verifyContractionHierarchy(int randomPairs) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        if (g.numVertices() == 0) {
+            return 0;
         }
-        return vector<string>();
-    }
-    
-    // ==================== DIJKSTRA - DENGAN RETURN PATHRESULT ====================
-    PathResult findShortestPath(const string& start, const string& end) {
-        PathResult result;
-        result.algorithm = "Dijkstra (Shortest Path)";
         
-        if (vertexMap.find(start) == vertexMap.end() || 
-            vertexMap.find(end) == vertexMap.end()) {
-            result.found = false;
-            return result;
+        int mismatches = 0, reachable = 0;
+        for (const auto& pair : randomAirportPairs(randomPairs, 7)) {
+            AirportId a = pair.first;
+            AirportId b = pair.second;
+            PathResult expected = findShortestPath(a, b);
+            PathResult actual = findShortestPathCH(a, b);
+            
+            bool ok = expected.found == actual.found;
+            if (ok && actual.found) {
+                reachable++;
+                vector<int> path = view->toVertexIds(actual.path);
+                bool validEdges = true;
+                for (size_t k = 0; k + 1 < path.size(); k++) {
+                    if (g.findEdge(path[k], path[k + 1]) == -1) {
+                        validEdges = false;
+                    }
+                }
+                ok = actual.totalDistance == expected.totalDistance && validEdges &&
+                     path.front() == view->vertexId(a) && path.back() == view->vertexId(b) &&
+                     view->pathDistance(path) == expected.totalDistance;
+            }
+            if (!ok) {
+                mismatches++;
+                if (mismatches <= 5) {
+                    cerr << "CH tidak cocok: " << a.toCode() << " -> " << b.toCode()
+                         << " (Dijkstra " << expected.totalDistance << " km, CH "
+                         << actual.totalDistance << " km)" << endl;
+                }
+            }
         }
         
-        unordered_map<string, int> distance;
-        unordered_map<string, string> parent;
-        priority_queue<NodeDistance, vector<NodeDistance>, greater<NodeDistance>> pq;
-        
-        for (const auto& pair : vertexMap) {
-            distance[pair.first] = numeric_limits<int>::max();
-        }
-        distance[start] = 0;
+        cout << "Verifikasi CH vs Dijkstra: " << randomPairs << " pasangan acak ("
+             << reachable << " terhubung), " << mismatches << " tidak cocok" << endl;
+        return mismatches;
+    }
+    
+    // ==================== K-SHORTEST PATHS (YEN) ====================
+
+private:
+    /**
+     * spurSearch - Dijkstra dari spur ke t dengan vertex terblokir dan edge spur terlarang
+     * @param blocked: blocked[v] != 0 berarti v tidak boleh dilewati (vertex root path)
+     * @param bannedTargets: Tetangga spur yang tidak boleh dipakai sebagai hop pertama
+     * @return: Path vertex ID spur..t, kosong jika tidak ada
+     */
+    vector<int> spurSearch(const CSRGraph& g, int spur, int t, const vector<char>& blocked,
+                           const vector<int>& bannedTargets, SearchWorkspace& workspace, int& settled) const {
+        workspace.prepare(g.numVertices());
+        SearchLabels& labels = workspace.forward;
+        NodeHeap& pq = workspace.heapForward;
         
-        pq.push(NodeDistance(start, 0));
+        labels.set(spur, 0, -1);
+        pq.push(NodeDistance(spur, 0));
         
         while (!pq.empty()) {
             NodeDistance current = pq.top();
             pq.pop();
+            int u = current.vertex;
+            if (current.distance > labels.dist[u]) {
+                continue;
+            }
+            settled++;
+            if (u == t) {
+                return reconstructPath(labels.parent, spur, t);
+            }
+            
+            for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                int v = g.targets[e];
+                if (blocked[v]) {
+                    continue;
+                }
+                if (u == spur && find(bannedTargets.begin(), bannedTargets.end(), v) != bannedTargets.end()) {
+                    continue;
+                }
+                int alt = current.distance + g.weights[e];
+                if (alt < labels.distance(v)) {
+                    labels.set(v, alt, u);
+                    pq.push(NodeDistance(v, alt));
+                }
+            }
+        }
+        return vector<int>();
+    }
+
+public:
+    /**
+     * findKShortestPaths - K rute tanpa loop terpendek (algoritma Yen)
+     * Rute ke-k dicari dengan spur search dari setiap vertex rute ke-(k-1): root path
+     * diblokir dan edge yang sudah dipakai rute dengan root yang sama dilarang.
+     * Kandidat disimpan di set terurut (jarak, path), jadi hasil deterministik.
+     * @param K: Jumlah rute maksimum
+     * @return: Sampai K PathResult terurut menaik berdasarkan totalDistance
+     */
+    vector<PathResult> findKShortestPaths(const string& start, const string& end, int K) const {
+        return findKShortestPaths(AirportId::fromCode(start), AirportId::fromCode(end), K);
+    }
+    
+    vector<PathResult> findKShortestPaths(AirportId start, AirportId end, int K) const {
+        return findKShortestPaths(start, end, K, threadWorkspace());
+    }
+    
+    vector<PathResult> findKShortestPaths(AirportId start, AirportId end, int K, SearchWorkspace& workspace) const {
+        vector<PathResult> results;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1 || K <= 0) {
+            return results;
+        }
+        
+        PathResult first = computeShortestPath(*view, start, end, workspace);
+        if (!first.found) {
+            return results;
+        }
+        
+        const CSRGraph& g = *view->csr;
+        vector<vector<int>> accepted;
+        accepted.push_back(view->toVertexIds(first.path));
+        first.algorithm = "Yen K-Shortest Paths";
+        results.push_back(first);
+        
+        set<pair<int, vector<int>>> candidates;
+        vector<char> blocked(g.numVertices(), 0);
+        vector<int> bannedTargets;
+        
+        while ((int)results.size() < K) {
+            const vector<int> previous = accepted.back();
+            int settled = 0;
             
-            string u = current.airport;
-            int dist = current.distance;
+            for (size_t i = 0; i + 1 < previous.size(); i++) {
+                int spur = previous[i];
+                
+                // Edge spur -> next dari rute yang punya root path sama dilarang
+                bannedTargets.clear();
+                for (const vector<int>& path : accepted) {
+                    if (path.size() > i + 1 && equal(previous.begin(), previous.begin() + i + 1, path.begin())) {
+                        bannedTargets.push_back(path[i + 1]);
+                    }
+                }
+                for (size_t k = 0; k < i; k++) {
+                    blocked[previous[k]] = 1;
+                }
+                
+                vector<int> spurPath = spurSearch(g, spur, t, blocked, bannedTargets, workspace, settled);
+                
+                for (size_t k = 0; k < i; k++) {
+                    blocked[previous[k]] = 0;
+                }
+                if (spurPath.empty()) {
+                    continue;
+                }
+                
+                vector<int> candidate(previous.begin(), previous.begin() + i);
+                candidate.insert(candidate.end(), spurPath.begin(), spurPath.end());
+                if (find(accepted.begin(), accepted.end(), candidate) == accepted.end()) {
+                    candidates.insert({view->pathDistance(candidate), candidate});
+                }
+            }
             
-            if (u == end) {
+            if (candidates.empty()) {
                 break;
             }
             
-            if (dist > distance[u]) {
-                continue;
+            auto best = candidates.begin();
+            accepted.push_back(best->second);
+            
+            PathResult result;
+            result.algorithm = "Yen K-Shortest Paths";
+            result.path = view->toCodes(best->second);
+            result.stops = best->second.size() - 1;
+            result.totalDistance = best->first;
+            result.found = true;
+            result.expandedNodes = settled;
+            results.push_back(result);
+            candidates.erase(best);
+        }
+        
+        return results;
+    }
+    
+    // ==================== BENCHMARK SHORTEST PATH ====================
+    
+private:
+    /**
+     * benchmarkPairs - Pasangan long-haul tetap + pasangan acak (seed 42) untuk benchmark
+     * @param longHaulCount: Diisi jumlah pasangan long-haul di awal daftar
+     */
+    vector<pair<AirportId, AirportId>> benchmarkPairs(int randomPairs, size_t& longHaulCount) const {
+        // Pasangan antar benua (long-haul) + pasangan acak
+        const char* longHaul[][2] = {
+            {"CGK", "JFK"}, {"SYD", "LHR"}, {"GRU", "NRT"}, {"JNB", "LAX"},
+            {"AKL", "CDG"}, {"SCL", "DXB"}, {"BPN", "YYZ"}, {"HNL", "CAI"}
+        };
+        vector<pair<AirportId, AirportId>> pairs;
+        for (const auto& codes : longHaul) {
+            if (hasVertex(codes[0]) && hasVertex(codes[1])) {
+                pairs.push_back({AirportId::fromCode(codes[0]), AirportId::fromCode(codes[1])});
+            }
+        }
+        longHaulCount = pairs.size();
+        
+        vector<pair<AirportId, AirportId>> randomPairList = randomAirportPairs(randomPairs, 42);
+        pairs.insert(pairs.end(), randomPairList.begin(), randomPairList.end());
+        return pairs;
+    }
+
+public:
+    /**
+     * benchmarkShortestPath - Membandingkan Dijkstra dengan varian yang lebih cepat
+     * Memakai pasangan long-haul tetap + pasangan acak (seed tetap agar bisa diulang).
+     * Setiap hasil dicek terhadap jarak Dijkstra biasa.
+     * @param randomPairs: Jumlah pasangan acak
+     */
+    void benchmarkShortestPath(int randomPairs) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        if (g.numVertices() == 0) {
+            cout << "Graph kosong!" << endl;
+            return;
+        }
+        
+        size_t longHaulCount = 0;
+        vector<pair<AirportId, AirportId>> pairs = benchmarkPairs(randomPairs, longHaulCount);
+        
+        struct BenchmarkEntry {
+            string name;
+            function<PathResult(AirportId, AirportId)> run;
+        };
+        vector<BenchmarkEntry> algorithms = {
+            {"Dijkstra", [this](AirportId a, AirportId b) {
+                SearchWorkspace& workspace = threadWorkspace();   // Tanpa cache hub / hasil
+                return findShortestPath(a, b, workspace, workspace.heapForward);
+            }},
+            {"Bidirectional", [this](AirportId a, AirportId b) { return findShortestPathBidirectional(a, b); }},
+            {"A*", [this](AirportId a, AirportId b) { return findShortestPathAStar(a, b); }},
+            {"ALT", [this](AirportId a, AirportId b) { return findShortestPathALT(a, b); }},
+            {"CH", [this](AirportId a, AirportId b) { return findShortestPathCH(a, b); }},
+        };
+        
+        // Preprocessing CH dan landmark ALT di luar pengukuran waktu query
+        contractionHierarchy(view->csr);
+        buildLandmarks();
+        
+        // Jarak referensi dari Dijkstra biasa
+        vector<int> reference(pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++) {
+            PathResult r = findShortestPath(pairs[i].first, pairs[i].second);
+            reference[i] = r.found ? r.totalDistance : -1;
+        }
+        
+        cout << "\n" << string(95, '=') << endl;
+        cout << "           BENCHMARK SHORTEST PATH (" << longHaulCount << " long-haul + "
+             << randomPairs << " pasangan acak)" << endl;
+        cout << string(95, '=') << endl;
+        cout << left << setw(18) << "ALGORITMA"
+             << setw(20) << "SETTLED LONG-HAUL"
+             << setw(18) << "SETTLED RATA2"
+             << setw(16) << "WAKTU RATA2"
+             << setw(12) << "SPEEDUP"
+             << setw(10) << "SALAH" << endl;
+        cout << string(95, '-') << endl;
+        
+        double baselineMicros = 0;
+        for (const BenchmarkEntry& algo : algorithms) {
+            long long settledLongHaul = 0, settledAll = 0;
+            int mismatches = 0;
+            
+            auto startTime = chrono::steady_clock::now();
+            for (size_t i = 0; i < pairs.size(); i++) {
+                PathResult r = algo.run(pairs[i].first, pairs[i].second);
+                settledAll += r.expandedNodes;
+                if (i < longHaulCount) {
+                    settledLongHaul += r.expandedNodes;
+                }
+                if ((r.found ? r.totalDistance : -1) != reference[i]) {
+                    mismatches++;
+                }
+            }
+            double micros = chrono::duration<double, micro>(chrono::steady_clock::now() - startTime).count()
+                            / pairs.size();
+            if (baselineMicros == 0) {
+                baselineMicros = micros;
+            }
+            
+            ostringstream timeText, speedupText;
+            timeText << fixed << setprecision(1) << micros << " us";
+            speedupText << fixed << setprecision(2) << (baselineMicros / max(micros, 1e-9)) << "x";
+            
+            cout << left << setw(18) << algo.name
+                 << setw(20) << (longHaulCount > 0 ? settledLongHaul / (long long)longHaulCount : 0)
+                 << setw(18) << settledAll / (long long)pairs.size()
+                 << setw(16) << timeText.str()
+                 << setw(12) << speedupText.str()
+                 << setw(10) << mismatches << endl;
+        }
+        cout << string(95, '=') << endl;
+        cout << "SETTLED = rata-rata node yang di-settle per query; SALAH = jarak beda dari Dijkstra" << endl;
+    }
+    
+    /**
+     * benchmarkPriorityQueues - Membandingkan policy priority queue Dijkstra
+     * Query point-to-point (pasangan sama dengan benchmarkShortestPath) dan one-to-all
+     * dari sampel bandara asal. Jarak dicek terhadap binary heap.
+     * @param randomPairs: Jumlah pasangan acak
+     */
+    void benchmarkPriorityQueues(int randomPairs) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        const CSRGraph& g = *view->csr;
+        if (g.numVertices() == 0) {
+            cout << "Graph kosong!" << endl;
+            return;
+        }
+        
+        size_t longHaulCount = 0;
+        vector<pair<AirportId, AirportId>> pairs = benchmarkPairs(randomPairs, longHaulCount);
+        const int ONE_TO_ALL_SOURCES = 200;
+        int sourceStride = max(1, g.numVertices() / ONE_TO_ALL_SOURCES);
+        
+        NodeHeap binaryHeap;
+        RadixHeapQueue radixHeap;
+        DialQueue dial;
+        QuaternaryHeapQueue quaternaryHeap;
+        SearchWorkspace workspace;
+        
+        // Checksum jarak one-to-all per sumber dari binary heap sebagai referensi
+        vector<int> reference(pairs.size());
+        vector<long long> referenceSums;
+        for (size_t i = 0; i < pairs.size(); i++) {
+            PathResult r = findShortestPath(pairs[i].first, pairs[i].second, workspace, binaryHeap);
+            reference[i] = r.found ? r.totalDistance : -1;
+        }
+        for (int source = 0; source < g.numVertices(); source += sourceStride) {
+            workspace.prepare(g.numVertices());
+            dijkstraSearch(g, source, -1, workspace.forward, binaryHeap);
+            referenceSums.push_back(labelChecksum(g, workspace.forward));
+        }
+        
+        cout << "\n" << string(95, '=') << endl;
+        cout << "           BENCHMARK PRIORITY QUEUE DIJKSTRA (" << pairs.size() << " query, "
+             << referenceSums.size() << " one-to-all, bobot maks " << g.maxWeight << " km)" << endl;
+        cout << string(95, '=') << endl;
+        cout << left << setw(22) << "QUEUE"
+             << setw(18) << "POINT-TO-POINT"
+             << setw(12) << "SPEEDUP"
+             << setw(18) << "ONE-TO-ALL"
+             << setw(12) << "SPEEDUP"
+             << setw(10) << "SALAH" << endl;
+        cout << string(95, '-') << endl;
+        
+        double baselinePointMicros = 0, baselineAllMicros = 0;
+        auto runQueue = [&](auto& pq) {
+            int mismatches = 0;
+            auto startTime = chrono::steady_clock::now();
+            for (size_t i = 0; i < pairs.size(); i++) {
+                PathResult r = findShortestPath(pairs[i].first, pairs[i].second, workspace, pq);
+                if ((r.found ? r.totalDistance : -1) != reference[i]) {
+                    mismatches++;
+                }
+            }
+            double pointMicros = chrono::duration<double, micro>(chrono::steady_clock::now() - startTime).count()
+                                 / max<size_t>(1, pairs.size());
+            
+            double allMicros = 0;
+            size_t index = 0;
+            for (int source = 0; source < g.numVertices(); source += sourceStride) {
+                workspace.prepare(g.numVertices());
+                auto sourceStart = chrono::steady_clock::now();
+                dijkstraSearch(g, source, -1, workspace.forward, pq);
+                allMicros += chrono::duration<double, micro>(chrono::steady_clock::now() - sourceStart).count();
+                if (labelChecksum(g, workspace.forward) != referenceSums[index++]) {
+                    mismatches++;
+                }
+            }
+            allMicros /= max<size_t>(1, referenceSums.size());
+            
+            if (baselinePointMicros == 0) {
+                baselinePointMicros = pointMicros;
+                baselineAllMicros = allMicros;
+            }
+            
+            ostringstream pointText, pointSpeedup, allText, allSpeedup;
+            pointText << fixed << setprecision(1) << pointMicros << " us";
+            pointSpeedup << fixed << setprecision(2) << (baselinePointMicros / max(pointMicros, 1e-9)) << "x";
+            allText << fixed << setprecision(1) << allMicros << " us";
+            allSpeedup << fixed << setprecision(2) << (baselineAllMicros / max(allMicros, 1e-9)) << "x";
+            
+            cout << left << setw(22) << pq.name()
+                 << setw(18) << pointText.str()
+                 << setw(12) << pointSpeedup.str()
+                 << setw(18) << allText.str()
+                 << setw(12) << allSpeedup.str()
+                 << setw(10) << mismatches << endl;
+        };
+        
+        runQueue(binaryHeap);
+        runQueue(radixHeap);
+        runQueue(dial);
+        runQueue(quaternaryHeap);
+        
+        cout << string(95, '=') << endl;
+        cout << "Waktu = rata-rata per query; SALAH = jarak beda dari binary heap" << endl;
+    }
+
+private:
+    // Checksum jarak semua vertex yang tercapai (untuk membandingkan hasil one-to-all)
+    long long labelChecksum(const CSRGraph& g, const SearchLabels& labels) const {
+        long long sum = 0;
+        for (int v = 0; v < g.numVertices(); v++) {
+            if (labels.reached(v)) {
+                sum += (long long)labels.dist[v] * (v + 1);
+            }
+        }
+        return sum;
+    }
+
+public:
+    
+    // ==================== PARETO ROUTES (STOPS vs JARAK) ====================
+
+private:
+    // Label Pareto: vertex dicapai dengan jarak tertentu, parent = indeks label sebelumnya
+    struct ParetoLabel {
+        int vertex;
+        int distance;
+        int parent;
+    };
+
+public:
+    /**
+     * findParetoRoutes - Frontier Pareto (stops, jarak) antara dua bandara dalam satu pencarian
+     * Label-setting per ronde jumlah stops: bucket ronde k berisi paling banyak satu label
+     * per vertex (jarak terbaik dengan tepat k edge). Label v hanya dibuat jika jaraknya lebih
+     * kecil dari semua label v dengan stops lebih sedikit (tidak terdominasi), dan dipangkas
+     * jika jarak + lower bound great-circle ke tujuan tidak lebih baik dari rute terbaik.
+     * @param maxStops: Batas stops, -1 = tanpa batas
+     * @return: Rute tidak terdominasi, stops naik dan jarak turun
+     */
+    vector<PathResult> findParetoRoutes(const string& start, const string& end, int maxStops = -1) const {
+        return findParetoRoutes(AirportId::fromCode(start), AirportId::fromCode(end), maxStops);
+    }
+    
+    vector<PathResult> findParetoRoutes(AirportId start, AirportId end, int maxStops = -1) const {
+        return findParetoRoutes(start, end, maxStops, threadWorkspace());
+    }
+    
+    vector<PathResult> findParetoRoutes(AirportId start, AirportId end, int maxStops, SearchWorkspace& workspace) const {
+        vector<PathResult> frontier;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1) {
+            return frontier;
+        }
+        
+        const CSRGraph& g = *view->csr;
+        int n = g.numVertices();
+        if (maxStops < 0 || maxStops > n - 1) {
+            maxStops = n - 1;
+        }
+        workspace.prepare(n);
+        SearchLabels& best = workspace.forward;    // Jarak terbaik ke v dengan stops <= ronde
+        SearchLabels& round = workspace.backward;  // Indeks label v di bucket ronde ini
+        
+        vector<ParetoLabel> labels;
+        vector<int> bucket, nextBucket;
+        labels.push_back({s, 0, -1});
+        bucket.push_back(0);
+        best.set(s, 0, -1);
+        
+        auto lowerBound = [&](int v) {
+            return g.heuristicScale > 0 ? (int)floor(g.heuristicScale * g.greatCircle(v, t)) : 0;
+        };
+        auto emit = [&](int labelIndex, int stops) {
+            vector<int> path;
+            for (int i = labelIndex; i != -1; i = labels[i].parent) {
+                path.push_back(labels[i].vertex);
             }
+            reverse(path.begin(), path.end());
+            
+            PathResult result;
+            result.algorithm = "Pareto (stops, jarak)";
+            result.path = view->toCodes(path);
+            result.stops = stops;
+            result.totalDistance = labels[labelIndex].distance;
+            result.found = true;
+            result.expandedNodes = labels.size();
+            frontier.push_back(result);
+        };
+        
+        if (s == t) {
+            emit(0, 0);
+            return frontier;
+        }
+        
+        for (int stops = 0; stops < maxStops && !bucket.empty(); stops++) {
+            round.reset(n);
+            nextBucket.clear();
+            int targetLabel = -1;
             
-            for (const Route& route : adjacencyList[u]) {
-                string v = route.destination;
-                int alt = distance[u] + route.distance;
+            for (int index : bucket) {
+                int u = labels[index].vertex;
+                int d = labels[index].distance;
+                if (best.reached(t) && d + lowerBound(u) >= best.dist[t]) {
+                    continue;
+                }
                 
-                if (alt < distance[v]) {
-                    distance[v] = alt;
-                    parent[v] = u;
-                    pq.push(NodeDistance(v, alt));
+                for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                    int v = g.targets[e];
+                    int alt = d + g.weights[e];
+                    // Terdominasi oleh label v dengan stops <= stops + 1
+                    if (alt >= best.distance(v)) {
+                        continue;
+                    }
+                    if (v != t && best.reached(t) && alt + lowerBound(v) >= best.dist[t]) {
+                        continue;
+                    }
+                    best.set(v, alt, u);
+                    
+                    if (round.reached(v)) {
+                        labels[round.dist[v]] = {v, alt, index};
+                    } else {
+                        round.set(v, labels.size(), index);
+                        labels.push_back({v, alt, index});
+                        if (v == t) {
+                            targetLabel = round.dist[v];
+                        } else {
+                            nextBucket.push_back(round.dist[v]);
+                        }
+                    }
+                }
+            }
+            
+            if (targetLabel != -1) {
+                emit(targetLabel, stops + 1);
+            }
+            bucket.swap(nextBucket);
+        }
+        
+        for (PathResult& result : frontier) {
+            result.expandedNodes = labels.size();
+        }
+        return frontier;
+    }
+    
+    // ==================== HOP-CONSTRAINED SHORTEST PATH ====================
+    
+    /**
+     * findShortestPathWithMaxStops - Rute jarak minimum dengan maksimal maxStops penerbangan
+     * Bellman-Ford berlapis atas state (bandara, hop): layer k berisi jarak minimum dengan
+     * <= k edge dalam array dense. Layer k hanya me-relax vertex yang membaik di layer k-1,
+     * dan state dipangkas jika jarak + lower bound great-circle tidak mengalahkan tujuan.
+     * @param maxStops: Maksimal jumlah edge dalam rute (sama dengan findAllPaths)
+     * @return: PathResult jarak minimum, found=false jika tidak ada rute dalam batas
+     */
+    PathResult findShortestPathWithMaxStops(const string& start, const string& end, int maxStops) const {
+        return findShortestPathWithMaxStops(AirportId::fromCode(start), AirportId::fromCode(end), maxStops);
+    }
+    
+    PathResult findShortestPathWithMaxStops(AirportId start, AirportId end, int maxStops) const {
+        return findShortestPathWithMaxStops(start, end, maxStops, threadWorkspace());
+    }
+    
+    PathResult findShortestPathWithMaxStops(AirportId start, AirportId end, int maxStops,
+                                            SearchWorkspace& workspace) const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        return cachedQuery(*view, start, end, QueryAlgorithm::MAX_STOPS, maxStops, [&]() {
+            return computeShortestPathWithMaxStops(*view, start, end, maxStops, workspace);
+        });
+    }
+
+private:
+    PathResult computeShortestPathWithMaxStops(const GraphSnapshot& view, AirportId start, AirportId end,
+                                               int maxStops, SearchWorkspace& workspace) const {
+        PathResult result;
+        result.algorithm = "Layered Bellman-Ford (max " + to_string(maxStops) + " stops)";
+        int s = view.vertexId(start);
+        int t = view.vertexId(end);
+        if (s == -1 || t == -1 || maxStops < 0) {
+            return result;
+        }
+        
+        const CSRGraph& g = *view.csr;
+        int n = g.numVertices();
+        maxStops = min(maxStops, n - 1);
+        workspace.prepare(n);
+        
+        // Memori O(n + jumlah perbaikan), tidak bergantung maxStops: jarak hanya disimpan untuk
+        // layer k-1 dan k, parent disimpan sparse sebagai record per perbaikan (vertex, layer).
+        const int INF = numeric_limits<int>::max();
+        vector<int>& dist = workspace.layerDist;
+        vector<int>& head = workspace.hopHead;
+        vector<HopRecord>& records = workspace.hopRecords;
+        dist.assign((size_t)2 * n, INF);
+        head.assign(n, -1);
+        records.clear();
+        int* prev = &dist[0];
+        int* cur = &dist[n];
+        prev[s] = cur[s] = 0;
+        
+        auto lowerBound = [&](int v) {
+            return g.heuristicScale > 0 ? (int)floor(g.heuristicScale * g.greatCircle(v, t)) : 0;
+        };
+        
+        SearchLabels& inLayer = workspace.forward;  // Penanda vertex sudah masuk active layer berikutnya
+        vector<int>& active = workspace.frontier;
+        vector<int> next;
+        active.push_back(s);
+        
+        // Berhenti saat layer tidak memperbaiki vertex mana pun (active kosong)
+        for (int k = 1; k <= maxStops && !active.empty(); k++) {
+            inLayer.reset(n);
+            next.clear();
+            for (int u : active) {
+                // Tujuan tidak di-expand; state yang tidak bisa mengalahkan tujuan dilewati
+                if (u == t || (cur[t] != INF && prev[u] + lowerBound(u) >= cur[t])) {
+                    continue;
+                }
+                result.expandedNodes++;
+                
+                for (int e = g.edgeBegin(u); e < g.edgeEnd(u); e++) {
+                    int v = g.targets[e];
+                    int alt = prev[u] + g.weights[e];
+                    if (alt >= cur[v]) {
+                        continue;
+                    }
+                    if (v != t && cur[t] != INF && alt + lowerBound(v) >= cur[t]) {
+                        continue;
+                    }
+                    cur[v] = alt;
+                    if (head[v] != -1 && records[head[v]].layer == k) {
+                        records[head[v]].parent = u;
+                    } else {
+                        records.push_back({k, u, head[v]});
+                        head[v] = records.size() - 1;
+                    }
+                    if (!inLayer.reached(v)) {
+                        inLayer.set(v, 0, -1);
+                        next.push_back(v);
+                    }
                 }
             }
+            
+            // Layer k jadi prev; buffer lama hanya berbeda di vertex yang membaik di layer k
+            swap(prev, cur);
+            for (int v : next) {
+                cur[v] = prev[v];
+            }
+            active.swap(next);
         }
         
-        if (distance[end] == numeric_limits<int>::max()) {
-            result.found = false;
+        if (prev[t] == INF) {
             return result;
         }
         
-        result.path = reconstructPath(parent, start, end);
-        result.stops = result.path.size() - 1;
-        result.totalDistance = distance[end];
-        result.found = true;
+        // Rekonstruksi: untuk (v, k) pakai record terbaru v dengan layer <= k, lalu lanjut ke
+        // parent-nya di layer sebelum record tersebut
+        vector<int> path(1, t);
+        int v = t;
+        int layer = maxStops;
+        while (v != s) {
+            int r = head[v];
+            while (records[r].layer > layer) {
+                r = records[r].previous;
+            }
+            v = records[r].parent;
+            layer = records[r].layer - 1;
+            path.push_back(v);
+        }
+        reverse(path.begin(), path.end());
         
+        result.path = view.toCodes(path);
+        result.stops = path.size() - 1;
+        result.totalDistance = prev[t];
+        result.found = true;
         return result;
     }
     
+public:
     // ==================== FITUR BARU: COMPARE ALGORITHMS ====================
-    void comparePathFindingAlgorithms(const string& start, const string& end) {
+    void comparePathFindingAlgorithms(const string& start, const string& end) const {
+        comparePathFindingAlgorithms(AirportId::fromCode(start), AirportId::fromCode(end));
+    }
+    
+    void comparePathFindingAlgorithms(AirportId start, AirportId end) const {
         cout << "\n" << string(95, '=') << endl;
         cout << "           PERBANDINGAN ALGORITMA: BFS vs DFS vs DIJKSTRA" << endl;
         cout << string(95, '=') << endl;
-        cout << "Dari: " << start << " (" << vertexMap[start].name << ")" << endl;
-        cout << "Ke  : " << end << " (" << vertexMap[end].name << ")" << endl;
+        cout << "Dari: " << start.toCode() << " (" << getAirportInfo(start).name << ")" << endl;
+        cout << "Ke  : " << end.toCode() << " (" << getAirportInfo(end).name << ")" << endl;
         cout << string(95, '=') << endl;
         
         // Jalankan semua algoritma
@@ -539,6 +4988,21 @@ public:
         cout << endl;
         cout << string(95, '-') << endl;
         
+        // Frontier Pareto: semua trade-off stops vs jarak yang tidak terdominasi
+        vector<PathResult> paretoRoutes = findParetoRoutes(start, end);
+        if (!paretoRoutes.empty()) {
+            cout << "\n📈 FRONTIER PARETO (stops vs jarak, " << paretoRoutes.size() << " opsi):" << endl;
+            for (const PathResult& option : paretoRoutes) {
+                cout << "   • " << left << setw(10) << (to_string(option.stops) + " stops")
+                     << setw(12) << (to_string(option.totalDistance) + " km");
+                for (size_t i = 0; i < option.path.size(); i++) {
+                    cout << option.path[i];
+                    if (i < option.path.size() - 1) cout << " → ";
+                }
+                cout << endl;
+            }
+        }
+        
         // Analisis Detail
         cout << "\n📊 ANALISIS DETAIL:" << endl;
         
@@ -624,251 +5088,1016 @@ public:
     
     // ==================== FUNGSI TRAVERSAL ====================
     
-    vector<string> traverse(const string& startAirport, const string& method) {
-        if (vertexMap.find(startAirport) == vertexMap.end()) {
-            return vector<string>();
+    vector<string> traverse(const string& startAirport, const string& method) const {
+        return traverse(AirportId::fromCode(startAirport), method);
+    }
+    
+    vector<string> traverse(AirportId startAirport, const string& method) const {
+        if (!hasVertex(startAirport)) {
+            return vector<string>();
+        }
+        
+        if (method == "BFS") {
+            return traverseBFS(startAirport);
+        } else if (method == "DFS") {
+            return traverseDFS(startAirport);
+        }
+        
+        return vector<string>();
+    }
+    
+    vector<string> traverseBFS(const string& start) const {
+        return traverseBFS(AirportId::fromCode(start));
+    }
+    
+    vector<string> traverseBFS(AirportId start) const {
+        return traverseBFS(start, threadWorkspace());
+    }
+    
+    vector<string> traverseBFS(AirportId start, SearchWorkspace& workspace) const {
+        vector<string> result;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        if (s == -1) {
+            return result;
+        }
+        
+        const CSRGraph& g = *view->csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& visited = workspace.forward;
+        vector<int>& q = workspace.frontier;
+        size_t head = 0;
+        
+        q.push_back(s);
+        visited.set(s, 0, -1);
+        
+        while (head < q.size()) {
+            int current = q[head++];
+            result.push_back(view->airportIds[current].toCode());
+            
+            for (int e = g.edgeBegin(current); e < g.edgeEnd(current); e++) {
+                int neighbor = g.targets[e];
+                if (!visited.reached(neighbor)) {
+                    visited.set(neighbor, 0, current);
+                    q.push_back(neighbor);
+                }
+            }
+        }
+        
+        return result;
+    }
+    
+    vector<string> traverseDFS(const string& start) const {
+        return traverseDFS(AirportId::fromCode(start));
+    }
+    
+    vector<string> traverseDFS(AirportId start) const {
+        return traverseDFS(start, threadWorkspace());
+    }
+    
+    vector<string> traverseDFS(AirportId start, SearchWorkspace& workspace) const {
+        vector<string> result;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        if (s == -1) {
+            return result;
+        }
+        
+        const CSRGraph& g = *view->csr;
+        workspace.prepare(g.numVertices());
+        SearchLabels& visited = workspace.forward;
+        vector<int>& st = workspace.frontier;
+        
+        st.push_back(s);
+        visited.set(s, 0, -1);
+            
+        while (!st.empty()) {
+            int current = st.back();
+            st.pop_back();
+            result.push_back(view->airportIds[current].toCode());
+            
+            for (int e = g.edgeBegin(current); e < g.edgeEnd(current); e++) {
+                int neighbor = g.targets[e];
+                if (!visited.reached(neighbor)) {
+                    visited.set(neighbor, 0, current);
+                    st.push_back(neighbor);
+                }
+            }
+        }
+        
+        return result;
+    }
+    
+    // ==================== FUNGSI TAMBAHAN ====================
+    
+    // Helper untuk validasi airport code input
+    bool validateAirportInput(const string& code, const string& label) const {
+        if (!hasVertex(code)) {
+            cout << "\n✗ " << label << " '" << code << "' tidak ditemukan dalam database!" << endl;
+            cout << "💡 Tip: Gunakan kode IATA 3 huruf (contoh: CGK, SIN, DPS)" << endl;
+            return false;
+        }
+        return true;
+    }
+    
+    // Load airports dari airports.csv (memory-mapped, field berupa string_view tanpa copy)
+    int loadAirports(const string& filename) {
+        auto startTime = chrono::steady_clock::now();
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Error: Tidak dapat membuka file " << filename << endl;
+            return 0;
+        }
+        
+        const char* data = file.data();
+        size_t size = file.size();
+        size_t pos = 0;
+        int count = 0;
+        LoadStats stats;
+        
+        vector<string_view> fields;     // Dipakai ulang untuk setiap baris
+        vector<string> slowFields;      // Hanya untuk field dengan quote di tengah
+        
+        while (pos < size) {
+            const char* lineEnd = (const char*)memchr(data + pos, '\n', size - pos);
+            size_t lineLength = lineEnd ? (size_t)(lineEnd - (data + pos)) : size - pos;
+            string_view line(data + pos, lineLength);
+            pos += lineLength + 1;
+            stats.rows++;
+            
+            // Skip header
+            if (stats.rows == 1) continue;
+            
+            splitCSVFields(line, fields, slowFields);
+            
+            if (fields.size() < 8) continue;  // Need at least 8 fields
+            
+            int airportID;
+            double latitude, longitude;
+            if (!parseIntField(fields[0], airportID) ||
+                !parseDoubleField(fields[6], latitude) ||
+                !parseDoubleField(fields[7], longitude)) {
+                // Skip invalid lines
+                continue;
+            }
+            
+            string_view iata = fields[4];
+            
+            // Only add airports with valid IATA code
+            if (iata != "\\N" && AirportId::fromCode(iata).isValid()) {
+                addVertex(string(iata), string(fields[1]), airportID, string(fields[2]),
+                          string(fields[3]), latitude, longitude);
+                count++;
+            }
+        }
+        
+        stats.bytes = size;
+        stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        printLoadStats(filename, stats);
+        return count;
+    }
+    
+private:
+    // Parse baris-baris routes.csv pada range [begin, end) ke dalam chunk.
+    // Hanya membaca graph (idIndex & airports), sehingga aman dijalankan paralel.
+    void parseRouteChunk(const char* data, size_t begin, size_t end, RouteChunk& chunk) const {
+        vector<string_view> fields;     // Dipakai ulang untuk setiap baris
+        vector<string> slowFields;      // Hanya untuk field dengan quote di tengah
+        size_t pos = begin;
+        
+        while (pos < end) {
+            const char* lineEnd = (const char*)memchr(data + pos, '\n', end - pos);
+            size_t lineLength = lineEnd ? (size_t)(lineEnd - (data + pos)) : end - pos;
+            string_view line(data + pos, lineLength);
+            pos += lineLength + 1;
+            chunk.rows++;
+            
+            splitCSVFields(line, fields, slowFields);
+            
+            if (fields.size() < 9) continue;
+            
+            int sourceId = getVertexId(AirportId::fromCode(fields[2]));
+            int destId = getVertexId(AirportId::fromCode(fields[4]));
+            
+            // Check if both airports exist in our graph
+            if (sourceId == -1 || destId == -1) {
+                chunk.skipped++;
+                continue;
+            }
+            
+            // Calculate distance using Haversine formula
+            const Airport& src = airports[sourceId];
+            const Airport& dst = airports[destId];
+            
+            int distance = (int)calculateDistance(src.latitude, src.longitude, 
+                                                   dst.latitude, dst.longitude);
+            
+            string_view airline = fields[0];
+            if (airline.data() < data + begin || airline.data() >= data + end) {
+                // Field slow-path menunjuk ke slowFields yang akan ditimpa baris berikutnya
+                chunk.slowFields.push_back(string(airline));
+                airline = string_view();
+            }
+            chunk.routes.push_back({sourceId, destId, distance, airline});
+        }
+    }
+    
+    // Tentukan jumlah thread loader: minimal 256 KB data per thread
+    int resolveLoadThreads(size_t fileSize) const {
+        if (loadThreads > 0) {
+            return loadThreads;
+        }
+        int hardware = max(1u, thread::hardware_concurrency());
+        int bySize = (int)(fileSize / (256 * 1024)) + 1;
+        return min(hardware, bySize);
+    }
+
+public:
+    /**
+     * setLoadThreads - Mengatur jumlah thread untuk loadRoutes
+     * @param threads: 1 = serial, >1 = paralel, 0 = otomatis (sesuai jumlah core)
+     */
+    void setLoadThreads(int threads) {
+        loadThreads = max(0, threads);
+    }
+    
+    // Load routes dari routes.csv (memory-mapped, parsing paralel per chunk, bulk build linear)
+    int loadRoutes(const string& filename,
+                   DuplicatePolicy policy = DuplicatePolicy::KEEP_ALL_AIRLINES) {
+        auto startTime = chrono::steady_clock::now();
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Error: Tidak dapat membuka file " << filename << endl;
+            return 0;
+        }
+        
+        const char* data = file.data();
+        size_t size = file.size();
+        int numThreads = resolveLoadThreads(size);
+        
+        // Bagi file menjadi chunk pada batas newline
+        vector<size_t> bounds(numThreads + 1, size);
+        bounds[0] = 0;
+        for (int i = 1; i < numThreads; i++) {
+            size_t pos = max(bounds[i - 1], size / numThreads * i);
+            const char* newline = pos < size ? (const char*)memchr(data + pos, '\n', size - pos) : nullptr;
+            bounds[i] = newline ? (size_t)(newline - data) + 1 : size;
+        }
+        
+        // Parsing + Haversine per chunk secara paralel
+        vector<RouteChunk> chunks(numThreads);
+        if (numThreads == 1) {
+            parseRouteChunk(data, 0, size, chunks[0]);
+        } else {
+            vector<thread> workers;
+            for (int i = 0; i < numThreads; i++) {
+                workers.emplace_back([this, data, &bounds, &chunks, i]() {
+                    parseRouteChunk(data, bounds[i], bounds[i + 1], chunks[i]);
+                });
+            }
+            for (thread& worker : workers) {
+                worker.join();
+            }
+        }
+        
+        // Merge buffer per thread sesuai urutan chunk (hasil identik dengan loader serial)
+        int skipped = 0;
+        LoadStats stats;
+        vector<RouteEdge> batch;
+        for (RouteChunk& chunk : chunks) {
+            size_t slowIndex = 0;
+            for (const ParsedRoute& route : chunk.routes) {
+                string airline = route.airline.data() != nullptr ? string(route.airline)
+                                                                 : chunk.slowFields[slowIndex++];
+                batch.push_back({route.from, route.to, route.distance, internAirline(airline)});
+            }
+            skipped += chunk.skipped;
+            stats.rows += chunk.rows;
+        }
+        int count = addRoutesBulk(batch, policy);
+        
+        stats.bytes = size;
+        stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        
+        if (skipped > 0) {
+            cout << "Info: " << skipped << " rute dilewati (bandara tidak ada dalam database)" << endl;
+        }
+        if (numThreads > 1) {
+            cout << "Info: routes diparsing paralel dengan " << numThreads << " thread" << endl;
+        }
+        printLoadStats(filename, stats);
+        
+        return count;
+    }
+    
+    // Load both files - convenience function
+    // Jika snapshotFile diisi dan snapshot masih sesuai dengan file CSV, CSV tidak diparsing sama sekali.
+    // Jika snapshot tidak ada / stale / rusak, load dari CSV lalu tulis snapshot baru.
+    pair<int, int> loadDataset(const string& airportsFile, const string& routesFile,
+                               const string& snapshotFile = "") {
+        bool useSnapshot = !snapshotFile.empty() && airports.empty();
+        
+        if (useSnapshot) {
+            auto startTime = chrono::steady_clock::now();
+            if (loadSnapshot(snapshotFile, airportsFile, routesFile)) {
+                double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+                cout << "✓ Snapshot " << snapshotFile << " dimuat dalam " 
+                     << fixed << setprecision(2) << ms << " ms (tanpa parsing CSV)" << endl;
+                return {(int)airports.size(), totalRouteCount};
+            }
+        }
+        
+        cout << "Loading airports dari " << airportsFile << "..." << endl;
+        int airportCount = loadAirports(airportsFile);
+        
+        if (airportCount == 0) {
+            return {0, 0};
+        }
+        
+        cout << "✓ " << airportCount << " bandara berhasil dimuat" << endl;
+        cout << "\nLoading routes dari " << routesFile << "..." << endl;
+        int routeCount = loadRoutes(routesFile);
+        
+        if (useSnapshot && routeCount > 0 && saveSnapshot(snapshotFile, airportsFile, routesFile)) {
+            cout << "Info: Snapshot disimpan ke " << snapshotFile << endl;
+        }
+        
+        return {airportCount, routeCount};
+    }
+    
+    // ==================== BINARY SNAPSHOT ====================
+    
+    /**
+     * saveSnapshot - Menyimpan graph ke file biner (tabel bandara, string pool, array CSR)
+     * @param filename: Path file snapshot
+     * @param airportsFile, routesFile: File sumber (untuk deteksi snapshot stale), boleh kosong
+     * @return: true jika berhasil ditulis
+     */
+    bool saveSnapshot(const string& filename, const string& airportsFile = "",
+                      const string& routesFile = "") const {
+        lock_guard<mutex> lock(writerMutex);   // Tabel rute dibaca langsung, jangan sampai diubah applyUpdates
+        const CSRGraph& g = csr();
+        SnapshotHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = SNAPSHOT_VERSION;
+        header.endianCheck = SNAPSHOT_ENDIAN_CHECK;
+        header.numVertices = airports.size();
+        header.numRoutes = totalRouteCount;
+        header.numAirlines = airlineNames.size();
+        header.numCSREdges = g.numEdges();
+        header.heuristicScale = g.heuristicScale;
+        header.maxWeight = g.maxWeight;
+        
+        string sourcePaths = airportsFile + "\n" + routesFile;
+        header.sourcePathHash = computeChecksum(sourcePaths.data(), sourcePaths.size());
+        getFileStamp(airportsFile, header.airportsFileSize, header.airportsFileTime);
+        getFileStamp(routesFile, header.routesFileSize, header.routesFileTime);
+        
+        // String pool + tabel vertex/maskapai
+        string stringPool;
+        auto addString = [&stringPool](const string& str, uint32_t& offset, uint32_t& length) {
+            offset = stringPool.size();
+            length = str.size();
+            stringPool += str;
+        };
+        
+        vector<SnapshotVertex> vertices(airports.size());
+        for (size_t v = 0; v < airports.size(); v++) {
+            SnapshotVertex& rec = vertices[v];
+            memset(&rec, 0, sizeof(rec));
+            rec.airportID = airports[v].id;
+            rec.code = airportIds[v].value;
+            rec.latitude = airports[v].latitude;
+            rec.longitude = airports[v].longitude;
+            addString(airports[v].name, rec.nameOffset, rec.nameLength);
+            addString(airports[v].city, rec.cityOffset, rec.cityLength);
+            addString(airports[v].country, rec.countryOffset, rec.countryLength);
+        }
+        
+        vector<SnapshotAirline> airlines(airlineNames.size());
+        for (size_t a = 0; a < airlineNames.size(); a++) {
+            addString(airlineNames[a], airlines[a].offset, airlines[a].length);
+        }
+        stringPool.resize((stringPool.size() + 7) / 8 * 8, '\0');
+        header.stringPoolSize = stringPool.size();
+        
+        // Semua rute (termasuk beda maskapai) dalam bentuk CSR
+        vector<int32_t> routeOffsets(airports.size() + 1, 0);
+        vector<int32_t> routeTargets, routeDistances, routeAirlines;
+        routeTargets.reserve(totalRouteCount);
+        routeDistances.reserve(totalRouteCount);
+        routeAirlines.reserve(totalRouteCount);
+        for (size_t v = 0; v < routeTable.size(); v++) {
+            for (const RouteRecord& r : routeTable[v]) {
+                routeTargets.push_back(r.target);
+                routeDistances.push_back(r.distance);
+                routeAirlines.push_back(r.airline);
+            }
+            routeOffsets[v + 1] = routeTargets.size();
+        }
+        
+        // Payload dalam satu buffer agar checksum bisa dihitung sebelum ditulis
+        string payload;
+        auto append = [&payload](const void* data, size_t bytes) {
+            payload.append((const char*)data, bytes);
+        };
+        append(vertices.data(), vertices.size() * sizeof(SnapshotVertex));
+        append(airlines.data(), airlines.size() * sizeof(SnapshotAirline));
+        append(g.unitX.data(), g.unitX.size() * sizeof(double));
+        append(g.unitY.data(), g.unitY.size() * sizeof(double));
+        append(g.unitZ.data(), g.unitZ.size() * sizeof(double));
+        append(routeOffsets.data(), routeOffsets.size() * sizeof(int32_t));
+        append(routeTargets.data(), routeTargets.size() * sizeof(int32_t));
+        append(routeDistances.data(), routeDistances.size() * sizeof(int32_t));
+        append(routeAirlines.data(), routeAirlines.size() * sizeof(int32_t));
+        append(g.offsets.data(), g.offsets.size() * sizeof(int32_t));
+        append(g.targets.data(), g.targets.size() * sizeof(int32_t));
+        append(g.weights.data(), g.weights.size() * sizeof(int32_t));
+        append(g.inOffsets.data(), g.inOffsets.size() * sizeof(int32_t));
+        append(g.inSources.data(), g.inSources.size() * sizeof(int32_t));
+        append(g.inWeights.data(), g.inWeights.size() * sizeof(int32_t));
+        payload.resize((payload.size() + 7) / 8 * 8, '\0');
+        append(stringPool.data(), stringPool.size());
+        
+        header.payloadSize = payload.size();
+        header.checksum = computeChecksum(payload.data(), payload.size());
+        
+        // Tulis ke file sementara lalu rename, supaya snapshot lama tidak rusak jika gagal di tengah
+        string tempFile = filename + ".tmp";
+        {
+            ofstream out(tempFile, ios::binary | ios::trunc);
+            if (!out.is_open()) {
+                cerr << "Error: Tidak dapat menulis snapshot " << filename << endl;
+                return false;
+            }
+            out.write((const char*)&header, sizeof(header));
+            out.write(payload.data(), payload.size());
+            if (!out.good()) {
+                cerr << "Error: Gagal menulis snapshot " << filename << endl;
+                return false;
+            }
+        }
+        
+        error_code ec;
+        filesystem::rename(tempFile, filename, ec);
+        if (ec) {
+            cerr << "Error: Gagal menyimpan snapshot " << filename << ": " << ec.message() << endl;
+            filesystem::remove(tempFile, ec);
+            return false;
+        }
+        return true;
+    }
+    
+    /**
+     * loadSnapshot - Memuat graph dari file snapshot (memory-mapped, tanpa parsing)
+     * Isi graph yang ada akan diganti seluruhnya.
+     * @param filename: Path file snapshot
+     * @param airportsFile, routesFile: Jika diisi, snapshot ditolak bila file sumber sudah berubah
+     * @return: false jika file tidak ada, versi/checksum tidak cocok, atau snapshot stale
+     */
+    bool loadSnapshot(const string& filename, const string& airportsFile = "",
+                      const string& routesFile = "") {
+        // Mapping dipegang shared_ptr: array CSR menunjuk langsung ke file ini
+        shared_ptr<MappedFile> file = make_shared<MappedFile>();
+        if (!file->open(filename)) {
+            return false;
+        }
+        
+        const char* data = file->data();
+        SnapshotHeader header;
+        if (file->size() < sizeof(header)) {
+            cerr << "Warning: Snapshot " << filename << " tidak valid, load ulang dari CSV" << endl;
+            return false;
+        }
+        memcpy(&header, data, sizeof(header));
+        
+        if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != SNAPSHOT_VERSION || header.endianCheck != SNAPSHOT_ENDIAN_CHECK ||
+            header.payloadSize != file->size() - sizeof(header)) {
+            cerr << "Warning: Snapshot " << filename << " tidak valid / versi berbeda, load ulang dari CSV" << endl;
+            return false;
+        }
+        
+        // Cek apakah file CSV sumber berubah setelah snapshot dibuat
+        if (!airportsFile.empty() || !routesFile.empty()) {
+            string sourcePaths = airportsFile + "\n" + routesFile;
+            uint64_t airportsSize = 0, routesSize = 0;
+            int64_t airportsTime = 0, routesTime = 0;
+            getFileStamp(airportsFile, airportsSize, airportsTime);
+            getFileStamp(routesFile, routesSize, routesTime);
+            
+            if (header.sourcePathHash != computeChecksum(sourcePaths.data(), sourcePaths.size()) ||
+                header.airportsFileSize != airportsSize || header.airportsFileTime != airportsTime ||
+                header.routesFileSize != routesSize || header.routesFileTime != routesTime) {
+                cout << "Info: Snapshot " << filename << " stale (file CSV berubah), load ulang dari CSV" << endl;
+                return false;
+            }
+        }
+        
+        const char* payload = data + sizeof(header);
+        if (computeChecksum(payload, header.payloadSize) != header.checksum) {
+            cerr << "Warning: Checksum snapshot " << filename << " tidak cocok, load ulang dari CSV" << endl;
+            return false;
+        }
+        
+        size_t numVertices = header.numVertices;
+        size_t numRoutes = header.numRoutes;
+        size_t numCSREdges = header.numCSREdges;
+        size_t arraysSize = numVertices * sizeof(SnapshotVertex) + header.numAirlines * sizeof(SnapshotAirline) +
+                            numVertices * 3 * sizeof(double) +
+                            ((numVertices + 1) * 3 + numRoutes * 3 + numCSREdges * 4) * sizeof(int32_t);
+        if ((arraysSize + 7) / 8 * 8 + header.stringPoolSize != header.payloadSize) {
+            cerr << "Warning: Snapshot " << filename << " tidak valid, load ulang dari CSV" << endl;
+            return false;
+        }
+        
+        const SnapshotVertex* vertices = (const SnapshotVertex*)payload;
+        const SnapshotAirline* airlines = (const SnapshotAirline*)(vertices + numVertices);
+        const double* unitX = (const double*)(airlines + header.numAirlines);
+        const double* unitY = unitX + numVertices;
+        const double* unitZ = unitY + numVertices;
+        const int32_t* routeOffsets = (const int32_t*)(unitZ + numVertices);
+        const int32_t* routeTargets = routeOffsets + numVertices + 1;
+        const int32_t* routeDistances = routeTargets + numRoutes;
+        const int32_t* routeAirlines = routeDistances + numRoutes;
+        const int32_t* csrOffsets = routeAirlines + numRoutes;
+        const int32_t* csrTargets = csrOffsets + numVertices + 1;
+        const int32_t* csrWeights = csrTargets + numCSREdges;
+        const int32_t* csrInOffsets = csrWeights + numCSREdges;
+        const int32_t* csrInSources = csrInOffsets + numVertices + 1;
+        const int32_t* csrInWeights = csrInSources + numCSREdges;
+        const char* stringPool = payload + (arraysSize + 7) / 8 * 8;
+        
+        // Checksum hanya membuktikan file tidak rusak acak, bukan layout-nya benar: semua nilai
+        // yang dipakai sebagai indeks dicek dulu sebelum isi graph diganti
+        const size_t MAX_WEIGHT = numeric_limits<int32_t>::max();
+        const size_t csrWeightLimit = header.maxWeight >= 0 ? (size_t)header.maxWeight + 1 : 0;
+        bool valid = numVertices <= (size_t)AIRPORT_ID_SPACE &&
+                     isfinite(header.heuristicScale) && header.heuristicScale >= 0 &&
+                     snapshotOffsetsValid(routeOffsets, numVertices, numRoutes) &&
+                     snapshotOffsetsValid(csrOffsets, numVertices, numCSREdges) &&
+                     snapshotOffsetsValid(csrInOffsets, numVertices, numCSREdges) &&
+                     snapshotValuesInRange(routeTargets, numRoutes, numVertices) &&
+                     snapshotValuesInRange(routeDistances, numRoutes, MAX_WEIGHT) &&
+                     snapshotValuesInRange(routeAirlines, numRoutes, header.numAirlines) &&
+                     snapshotValuesInRange(csrTargets, numCSREdges, numVertices) &&
+                     snapshotValuesInRange(csrWeights, numCSREdges, csrWeightLimit) &&
+                     snapshotValuesInRange(csrInSources, numCSREdges, numVertices) &&
+                     snapshotValuesInRange(csrInWeights, numCSREdges, csrWeightLimit);
+        
+        auto inStringPool = [&header](uint32_t offset, uint32_t length) {
+            return (uint64_t)offset + length <= header.stringPoolSize;
+        };
+        vector<char> codeUsed(valid ? AIRPORT_ID_SPACE : 0, 0);
+        for (size_t v = 0; valid && v < numVertices; v++) {
+            SnapshotVertex rec;
+            memcpy(&rec, vertices + v, sizeof(rec));
+            valid = rec.code < AIRPORT_ID_SPACE && !codeUsed[rec.code] &&
+                    inStringPool(rec.nameOffset, rec.nameLength) &&
+                    inStringPool(rec.cityOffset, rec.cityLength) &&
+                    inStringPool(rec.countryOffset, rec.countryLength);
+            if (valid) {
+                codeUsed[rec.code] = 1;
+            }
+        }
+        for (size_t a = 0; valid && a < header.numAirlines; a++) {
+            SnapshotAirline rec;
+            memcpy(&rec, airlines + a, sizeof(rec));
+            valid = inStringPool(rec.offset, rec.length);
+        }
+        if (!valid) {
+            cerr << "Warning: Snapshot " << filename << " tidak valid (isi di luar batas), load ulang dari CSV" << endl;
+            return false;
+        }
+        
+        // Ganti isi graph dengan isi snapshot
+        airports.clear();
+        airportIds.clear();
+        idIndex.assign(AIRPORT_ID_SPACE, -1);
+        routeTable.assign(numVertices, vector<RouteRecord>());
+        incomingTable.assign(numVertices, vector<RouteRecord>());
+        airlineNames.clear();
+        airlineToId.clear();
+        
+        airports.reserve(numVertices);
+        airportIds.reserve(numVertices);
+        for (size_t v = 0; v < numVertices; v++) {
+            SnapshotVertex rec;
+            memcpy(&rec, vertices + v, sizeof(rec));
+            airports.push_back(Airport(AirportId(rec.code).toCode(),
+                                       string(stringPool + rec.nameOffset, rec.nameLength),
+                                       rec.airportID,
+                                       string(stringPool + rec.cityOffset, rec.cityLength),
+                                       string(stringPool + rec.countryOffset, rec.countryLength),
+                                       rec.latitude, rec.longitude));
+            airportIds.push_back(AirportId(rec.code));
+            idIndex[rec.code] = v;
+        }
+        
+        for (size_t a = 0; a < header.numAirlines; a++) {
+            SnapshotAirline rec;
+            memcpy(&rec, airlines + a, sizeof(rec));
+            airlineNames.push_back(string(stringPool + rec.offset, rec.length));
+            airlineToId[airlineNames.back()] = a;
+        }
+        
+        for (size_t v = 0; v < numVertices; v++) {
+            vector<RouteRecord>& routes = routeTable[v];
+            routes.reserve(routeOffsets[v + 1] - routeOffsets[v]);
+            for (int32_t e = routeOffsets[v]; e < routeOffsets[v + 1]; e++) {
+                routes.push_back(RouteRecord(routeTargets[e], routeDistances[e], routeAirlines[e]));
+                incomingTable[routeTargets[e]].push_back(RouteRecord(v, routeDistances[e], routeAirlines[e]));
+            }
+        }
+        totalRouteCount = numRoutes;
+        
+        // Array CSR dan data heuristic menunjuk langsung ke file (zero-copy), tanpa rebuild;
+        // mapping ditutup saat CSR terakhir yang memakainya dilepas
+        shared_ptr<CSRGraph> g = make_shared<CSRGraph>();
+        g->offsets.view(csrOffsets, numVertices + 1, file);
+        g->targets.view(csrTargets, numCSREdges, file);
+        g->weights.view(csrWeights, numCSREdges, file);
+        g->inOffsets.view(csrInOffsets, numVertices + 1, file);
+        g->inSources.view(csrInSources, numCSREdges, file);
+        g->inWeights.view(csrInWeights, numCSREdges, file);
+        g->unitX.view(unitX, numVertices, file);
+        g->unitY.view(unitY, numVertices, file);
+        g->unitZ.view(unitZ, numVertices, file);
+        g->heuristicScale = header.heuristicScale;
+        g->maxWeight = header.maxWeight;
+        csrCache = g;
+        csrDirty = false;
+        graphVersion++;
+        
+        return true;
+    }
+    
+    Airport getAirportInfo(const string& airportCode) const {
+        return getAirportInfo(AirportId::fromCode(airportCode));
+    }
+    
+    Airport getAirportInfo(AirportId airport) const {
+        int id = getVertexId(airport);
+        if (id != -1) {
+            return airports[id];
+        }
+        return Airport();
+    }
+    
+    /**
+     * findAllPaths - Semua path tanpa loop start -> end dengan maksimal maxStops edge
+     * Menampung seluruh hasil di memori; untuk hub besar gunakan versi callback.
+     * @return: Daftar path (kode bandara) dalam urutan DFS
+     */
+    vector<vector<string>> findAllPaths(const string& start, const string& end, int maxStops) const {
+        return findAllPaths(AirportId::fromCode(start), AirportId::fromCode(end), maxStops);
+    }
+    
+    vector<vector<string>> findAllPaths(AirportId start, AirportId end, int maxStops) const {
+        vector<vector<string>> allPaths;
+        findAllPaths(start, end, maxStops, [&allPaths](const vector<string>& path) {
+            allPaths.push_back(path);
+            return true;
+        });
+        return allPaths;
+    }
+    
+    /**
+     * findAllPaths - Enumerasi streaming path tanpa loop dengan pruning
+     * Setiap path dikirim ke onPath begitu ditemukan, tidak ditampung. Sebelum DFS,
+     * BFS terbalik dari end menghitung minimum hop v -> end; cabang ke v dipangkas
+     * jika hop tersebut melebihi sisa stops, jadi DFS tidak masuk ke cabang buntu.
+     * @param onPath: Callback per path, return false untuk berhenti
+     * @param limits: Batas jumlah path dan waktu (ms), 0 = tanpa batas
+     * @return: Statistik enumerasi (jumlah path, node di-expand, alasan berhenti)
+     */
+    PathEnumerationStats findAllPaths(const string& start, const string& end, int maxStops,
+                                      const PathCallback& onPath,
+                                      const PathEnumerationLimits& limits = PathEnumerationLimits()) const {
+        return findAllPaths(AirportId::fromCode(start), AirportId::fromCode(end), maxStops, onPath, limits);
+    }
+    
+    PathEnumerationStats findAllPaths(AirportId start, AirportId end, int maxStops,
+                                      const PathCallback& onPath,
+                                      const PathEnumerationLimits& limits = PathEnumerationLimits()) const {
+        PathEnumerationStats stats;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1 || maxStops < 0) {
+            return stats;
         }
         
-        if (method == "BFS") {
-            return traverseBFS(startAirport);
-        } else if (method == "DFS") {
-            return traverseDFS(startAirport);
-        }
+        auto startTime = chrono::steady_clock::now();
+        const CSRGraph& g = *view->csr;
         
-        return vector<string>();
-    }
-    
-    vector<string> traverseBFS(const string& start) {
-        vector<string> result;
-        unordered_map<string, bool> visited;
-        queue<string> q;
+        // Label hop milik pemanggilan ini, bukan threadWorkspace(): onPath boleh menjalankan
+        // pencarian lain di thread yang sama (prepare() akan menghapus label workspace)
+        SearchLabels hops;
+        vector<int> queue;
+        hops.reset(g.numVertices());
+        reverseHopDistances(g, t, maxStops, hops, queue);
         
-        q.push(start);
-        visited[start] = true;
+        PathEnumerationState state(g.numVertices(), limits.timeBudgetMillis);
+        state.path.push_back(s);
+        state.visited[s] = 1;
         
-        while (!q.empty()) {
-            string current = q.front();
-            q.pop();
-            result.push_back(current);
-            
-            for (const Route& route : adjacencyList[current]) {
-                if (!visited[route.destination]) {
-                    visited[route.destination] = true;
-                    q.push(route.destination);
-                }
+        auto emit = [&](const vector<int>& path) {
+            stats.pathsFound++;
+            if (!onPath(view->toCodes(path))) {
+                stats.truncated = true;
+                return false;
+            }
+            if (limits.maxResults > 0 && stats.pathsFound >= limits.maxResults) {
+                stats.truncated = true;
+                return false;
             }
+            return true;
+        };
+        
+        if (hops.reached(s)) {
+            enumeratePaths(g, s, t, maxStops, hops, state, emit);
         }
         
-        return result;
+        stats.nodesExpanded = state.nodesExpanded;
+        stats.timedOut = state.timedOut;
+        stats.millis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+        return stats;
     }
     
-    vector<string> traverseDFS(const string& start) {
-        vector<string> result;
-        unordered_map<string, bool> visited;
-        stack<string> s;
-        
-        s.push(start);
-        visited[start] = true;
+    /**
+     * verifyPathEnumeration - Cek findAllPaths tetap lengkap walaupun callback menjalankan query
+     * Enumerasi dengan callback biasa dibandingkan dengan callback yang memanggil
+     * findShortestPath dan findPathBFS di setiap path (memakai threadWorkspace yang sama),
+     * baik versi sekuensial maupun paralel (onPath paralel dipanggil serial, tanpa lock tambahan).
+     * @return: Jumlah path yang berbeda dari enumerasi sekuensial dengan callback biasa
+     */
+    int verifyPathEnumeration(const string& start, const string& end, int maxStops,
+                              const PathEnumerationLimits& limits = PathEnumerationLimits()) const {
+        set<vector<string>> expected, nested, parallelNested;
+        findAllPaths(start, end, maxStops, [&expected](const vector<string>& path) {
+            expected.insert(path);
+            return true;
+        }, limits);
+        auto collectWithQuery = [this](set<vector<string>>& paths) {
+            return [this, &paths](const vector<string>& path) {
+                findShortestPath(path.front(), path.back());
+                findPathBFS(path.back(), path.front());
+                paths.insert(path);
+                return true;
+            };
+        };
+        findAllPaths(start, end, maxStops, collectWithQuery(nested), limits);
+        findAllPathsParallel(start, end, maxStops, collectWithQuery(parallelNested), limits);
         
-        while (!s.empty()) {
-            string current = s.top();
-            s.pop();
-            result.push_back(current);
-            
-            for (const Route& route : adjacencyList[current]) {
-                if (!visited[route.destination]) {
-                    visited[route.destination] = true;
-                    s.push(route.destination);
-                }
+        int mismatches = 0;
+        for (const set<vector<string>>* actual : {&nested, &parallelNested}) {
+            for (const auto& path : expected) {
+                mismatches += actual->count(path) == 0;
+            }
+            for (const auto& path : *actual) {
+                mismatches += expected.count(path) == 0;
             }
         }
-        
-        return result;
-    }
-    
-    // ==================== FUNGSI TAMBAHAN ====================
-    
-    // Helper untuk validasi airport code input
-    bool validateAirportInput(const string& code, const string& label) {
-        if (vertexMap.find(code) == vertexMap.end()) {
-            cout << "\n✗ " << label << " '" << code << "' tidak ditemukan dalam database!" << endl;
-            cout << "💡 Tip: Gunakan kode IATA 3 huruf (contoh: CGK, SIN, DPS)" << endl;
-            return false;
-        }
-        return true;
+        cout << "Verifikasi callback dengan query: " << expected.size() << " path, sekuensial "
+             << nested.size() << ", paralel " << parallelNested.size() << ", "
+             << mismatches << " tidak cocok" << endl;
+        return mismatches;
     }
-    
-    // Load airports dari airports.csv
-    int loadAirports(const string& filename) {
-        ifstream file(filename);
-        if (!file.is_open()) {
-            cerr << "Error: Tidak dapat membuka file " << filename << endl;
-            return 0;
-        }
-        
-        string line;
-        int count = 0;
-        
-        // Skip header
-        getline(file, line);
+
+private:
+    /**
+     * reverseHopDistances - BFS di graph terbalik dari end sampai kedalaman maxHops
+     * @param hops: hops.dist[v] = minimum edge v -> end (valid jika hops.reached(v))
+     * @param queue: Buffer queue BFS
+     */
+    void reverseHopDistances(const CSRGraph& g, int end, int maxHops, SearchLabels& hops, vector<int>& queue) const {
+        queue.clear();
+        queue.push_back(end);
+        hops.set(end, 0, -1);
         
-        while (getline(file, line)) {
-            vector<string> fields = parseCSVLine(line);
-            
-            if (fields.size() < 8) continue;  // Need at least 8 fields
-            
-            try {
-                int airportID = stoi(fields[0]);
-                string name = fields[1];
-                string city = fields[2];
-                string country = fields[3];
-                string iata = fields[4];
-                double latitude = stod(fields[6]);
-                double longitude = stod(fields[7]);
-                
-                // Only add airports with valid IATA code
-                if (iata != "\\N" && iata.length() == 3) {
-                    addVertex(iata, name, airportID, city, country, latitude, longitude);
-                    count++;
-                }
-            } catch (...) {
-                // Skip invalid lines
+        for (size_t head = 0; head < queue.size(); head++) {
+            int v = queue[head];
+            int nextHop = hops.dist[v] + 1;
+            if (nextHop > maxHops) {
                 continue;
             }
+            for (int e = g.inEdgeBegin(v); e < g.inEdgeEnd(v); e++) {
+                int u = g.inSources[e];
+                if (!hops.reached(u)) {
+                    hops.set(u, nextHop, v);
+                    queue.push_back(u);
+                }
+            }
         }
-        
-        file.close();
-        return count;
     }
     
-    // Load routes dari routes.csv
-    int loadRoutes(const string& filename) {
-        ifstream file(filename);
-        if (!file.is_open()) {
-            cerr << "Error: Tidak dapat membuka file " << filename << endl;
-            return 0;
+    /**
+     * enumeratePaths - DFS rekursif enumerasi path dengan pruning hop ke end
+     * @param remaining: Sisa edge yang boleh dipakai dari current
+     * @return: false jika enumerasi harus berhenti (emit menolak atau waktu habis)
+     */
+    template <typename Emit>
+    bool enumeratePaths(const CSRGraph& g, int current, int end, int remaining,
+                        const SearchLabels& hops, PathEnumerationState& state, Emit& emit) const {
+        if (current == end) {
+            return emit(state.path);
         }
         
-        string line;
-        int count = 0;
-        int skipped = 0;
+        // Cek waktu / pembatalan tiap 1024 node supaya overhead clock tidak dominan
+        if ((++state.nodesExpanded & 1023) == 0 && state.shouldStop()) {
+            return false;
+        }
         
-        while (getline(file, line)) {
-            vector<string> fields = parseCSVLine(line);
-            
-            if (fields.size() < 9) continue;
-            
-            string airline = fields[0];
-            string sourceIATA = fields[2];
-            string destIATA = fields[4];
-            
-            // Check if both airports exist in our graph
-            if (vertexMap.find(sourceIATA) == vertexMap.end() || 
-                vertexMap.find(destIATA) == vertexMap.end()) {
-                skipped++;
+        for (int e = g.edgeBegin(current); e < g.edgeEnd(current); e++) {
+            int next = g.targets[e];
+            if (state.visited[next] || !hops.reached(next) || hops.dist[next] > remaining - 1) {
                 continue;
             }
+                
+            state.path.push_back(next);
+            state.visited[next] = 1;
+                
+            bool keepGoing = enumeratePaths(g, next, end, remaining - 1, hops, state, emit);
             
-            // Calculate distance using Haversine formula
-            Airport& src = vertexMap[sourceIATA];
-            Airport& dst = vertexMap[destIATA];
-            
-            int distance = (int)calculateDistance(src.latitude, src.longitude, 
-                                                   dst.latitude, dst.longitude);
+            state.path.pop_back();
+            state.visited[next] = 0;
             
-            addEdge(sourceIATA, destIATA, distance, airline);
-            count++;
-        }
-        
-        file.close();
-        
-        if (skipped > 0) {
-            cout << "Info: " << skipped << " rute dilewati (bandara tidak ada dalam database)" << endl;
+            if (!keepGoing) {
+                return false;
+            }
         }
-        
-        return count;
+        return true;
     }
     
-    // Load both files - convenience function
-    pair<int, int> loadDataset(const string& airportsFile, const string& routesFile) {
-        cout << "Loading airports dari " << airportsFile << "..." << endl;
-        int airportCount = loadAirports(airportsFile);
-        
-        if (airportCount == 0) {
-            return {0, 0};
-        }
-        
-        cout << "✓ " << airportCount << " bandara berhasil dimuat" << endl;
-        cout << "\nLoading routes dari " << routesFile << "..." << endl;
-        int routeCount = loadRoutes(routesFile);
-        
-        return {airportCount, routeCount};
+    static const size_t SINK_BATCH_SIZE = 256;   // Path per pengiriman ke PathSink
+    static const int TASKS_PER_THREAD = 8;       // Target task minimum per thread saat split
+
+public:
+    /**
+     * findAllPathsParallel - Enumerasi path paralel dengan work stealing
+     * Pohon DFS dipecah di 1 hop pertama (diperdalam ke 2 hop jika task kurang dari
+     * TASKS_PER_THREAD per thread). Setiap prefix menjadi task dengan buffer path dan
+     * visited milik worker. Himpunan hasil sama dengan findAllPaths sekuensial, tetapi
+     * urutannya tidak deterministik. onPath dipanggil serial (tidak perlu thread-safe).
+     * @param threads: Jumlah thread, 0 = otomatis
+     * @return: Statistik enumerasi (node di-expand dijumlah dari semua worker)
+     */
+    PathEnumerationStats findAllPathsParallel(const string& start, const string& end, int maxStops,
+                                              const PathCallback& onPath,
+                                              const PathEnumerationLimits& limits = PathEnumerationLimits(),
+                                              int threads = 0) const {
+        return findAllPathsParallel(AirportId::fromCode(start), AirportId::fromCode(end), maxStops,
+                                    onPath, limits, threads);
     }
     
-    Airport getAirportInfo(const string& airportCode) {
-        if (vertexMap.find(airportCode) != vertexMap.end()) {
-            return vertexMap[airportCode];
+    PathEnumerationStats findAllPathsParallel(AirportId start, AirportId end, int maxStops,
+                                              const PathCallback& onPath,
+                                              const PathEnumerationLimits& limits = PathEnumerationLimits(),
+                                              int threads = 0) const {
+        PathEnumerationStats stats;
+        shared_ptr<const GraphSnapshot> view = snapshot();
+        int s = view->vertexId(start);
+        int t = view->vertexId(end);
+        if (s == -1 || t == -1 || maxStops < 0) {
+            return stats;
+        }
+        if (s == t) {
+            return findAllPaths(start, end, maxStops, onPath, limits);
         }
-        return Airport();
-    }
-    
-    vector<vector<string>> findAllPaths(const string& start, const string& end, int maxStops) {
-        vector<vector<string>> allPaths;
-        vector<string> currentPath;
-        set<string> visited;
         
-        currentPath.push_back(start);
-        visited.insert(start);
+        auto startTime = chrono::steady_clock::now();
+        const CSRGraph& g = *view->csr;
+        int numThreads = resolveThreads(threads);
         
-        findAllPathsDFS(start, end, maxStops, 0, currentPath, visited, allPaths);
+        // Hop ke end dihitung sekali, dibaca bersama (read-only) oleh semua worker. Label milik
+        // pemanggilan ini: onPath yang menjalankan query di thread pemanggil tidak boleh menghapusnya.
+        SearchLabels hops;
+        vector<int> queue;
+        hops.reset(g.numVertices());
+        reverseHopDistances(g, t, maxStops, hops, queue);
         
-        return allPaths;
-    }
-    
-    void findAllPathsDFS(const string& current, const string& end, int maxStops, 
-                        int currentStops, vector<string>& path, 
-                        set<string>& visited, vector<vector<string>>& allPaths) {
-        if (current == end) {
-            allPaths.push_back(path);
-            return;
+        PathSink sink(onPath, limits.maxResults);
+        vector<vector<int>> prefixes;
+        vector<vector<string>> directPaths;   // Path yang sudah sampai end di dalam prefix
+        if (hops.reached(s)) {
+            prefixes.push_back(vector<int>(1, s));
         }
         
-        if (currentStops >= maxStops) {
-            return;
+        for (int depth = 0; depth < 2 && depth < maxStops && !prefixes.empty(); depth++) {
+            if (depth > 0 && prefixes.size() >= (size_t)numThreads * TASKS_PER_THREAD) {
+                break;
+            }
+            vector<vector<int>> next;
+            for (const vector<int>& prefix : prefixes) {
+                int remaining = maxStops - (int)(prefix.size() - 1);
+                for (int e = g.edgeBegin(prefix.back()); e < g.edgeEnd(prefix.back()); e++) {
+                    int v = g.targets[e];
+                    if (!hops.reached(v) || hops.dist[v] > remaining - 1 ||
+                        find(prefix.begin(), prefix.end(), v) != prefix.end()) {
+                        continue;
+                    }
+                    vector<int> extended = prefix;
+                    extended.push_back(v);
+                    if (v == t) {
+                        directPaths.push_back(view->toCodes(extended));
+                    } else {
+                        next.push_back(move(extended));
+                    }
+                }
+            }
+            prefixes.swap(next);
         }
         
-        for (const Route& route : adjacencyList[current]) {
-            if (visited.find(route.destination) == visited.end()) {
-                path.push_back(route.destination);
-                visited.insert(route.destination);
-                
-                findAllPathsDFS(route.destination, end, maxStops, currentStops + 1, 
-                              path, visited, allPaths);
-                
-                path.pop_back();
-                visited.erase(route.destination);
+        if (!directPaths.empty()) {
+            sink.deliver(directPaths);
+        }
+        
+        int workers = (int)max<size_t>(1, min<size_t>(numThreads, prefixes.size()));
+        PathTaskPool pool(workers);
+        for (size_t i = 0; i < prefixes.size(); i++) {
+            pool.push(i % workers, PathTask{move(prefixes[i])});
+        }
+        
+        atomic<size_t> nodesExpanded(0);
+        atomic<bool> timedOut(false);
+        auto worker = [&](int id) {
+            PathEnumerationState state(g.numVertices(), limits.timeBudgetMillis, startTime);
+            state.cancelled = &sink.stopFlag();
+            vector<vector<string>> batch;
+            auto emit = [&](const vector<int>& path) {
+                batch.push_back(view->toCodes(path));
+                if (batch.size() < SINK_BATCH_SIZE) {
+                    return true;
+                }
+                bool keepGoing = sink.deliver(batch);
+                batch.clear();
+                return keepGoing;
+            };
+            
+            PathTask task;
+            while (!state.timedOut && !sink.stopFlag() && pool.pop(id, task)) {
+                state.path = task.prefix;
+                for (int v : task.prefix) {
+                    state.visited[v] = 1;
+                }
+                enumeratePaths(g, task.prefix.back(), t, maxStops - (int)(task.prefix.size() - 1),
+                               hops, state, emit);
+                for (int v : task.prefix) {
+                    state.visited[v] = 0;
+                }
+            }
+            if (!batch.empty()) {
+                sink.deliver(batch);
+            }
+            
+            nodesExpanded += state.nodesExpanded;
+            if (state.timedOut) {
+                timedOut = true;
+            }
+        };
+        
+        if (workers <= 1) {
+            worker(0);
+        } else {
+            vector<thread> workerThreads;
+            for (int i = 0; i < workers; i++) {
+                workerThreads.emplace_back(worker, i);
+            }
+            for (thread& th : workerThreads) {
+                th.join();
             }
         }
+        
+        stats.pathsFound = sink.count();
+        stats.nodesExpanded = nodesExpanded;
+        stats.truncated = sink.wasTruncated();
+        stats.timedOut = timedOut;
+        stats.millis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+        return stats;
     }
     
-    Statistics getStatistics() {
+public:
+    Statistics getStatistics() const {
+        shared_ptr<const GraphSnapshot> view = snapshot();
         Statistics stats;
-        stats.totalAirports = vertexMap.size();
+        stats.totalAirports = view->airportIds.size();
         stats.totalRoutes = 0;
         stats.maxDegree = 0;
         stats.minDegree = numeric_limits<int>::max();
         
-        for (const auto& pair : adjacencyList) {
-            int degree = pair.second.size();
+        for (size_t v = 0; v < view->airportIds.size(); v++) {
+            int degree = view->routeOffsets[v + 1] - view->routeOffsets[v];
             stats.totalRoutes += degree;
             
             if (degree > stats.maxDegree) {
                 stats.maxDegree = degree;
-                stats.maxDegreeAirport = pair.first;
+                stats.maxDegreeAirport = view->airportIds[v].toCode();
             }
             if (degree < stats.minDegree && degree > 0) {
                 stats.minDegree = degree;
-                stats.minDegreeAirport = pair.first;
+                stats.minDegreeAirport = view->airportIds[v].toCode();
             }
         }
         
@@ -880,7 +6109,7 @@ public:
     
     // ==================== DISPLAY FUNCTIONS ====================
     
-    void displayNeighbors(const string& airportCode) {
+    void displayNeighbors(const string& airportCode) const {
         vector<Route> neighbors = getNeighbors(airportCode);
         
         if (neighbors.empty()) {
@@ -889,7 +6118,7 @@ public:
         }
         
         // Get source airport info
-        Airport srcInfo = vertexMap[airportCode];
+        Airport srcInfo = getAirportInfo(airportCode);
         
         cout << "\nRute langsung dari " << airportCode << " (" << srcInfo.name << "):" << endl;
         cout << string(90, '=') << endl;
@@ -900,7 +6129,7 @@ public:
         cout << string(90, '=') << endl;
         
         for (const Route& route : neighbors) {
-            Airport destInfo = vertexMap[route.destination];
+            Airport destInfo = getAirportInfo(route.destination);
             cout << left << setw(8) << route.destination
                  << setw(35) << destInfo.name.substr(0, 33)  // Truncate if too long
                  << setw(12) << route.distance
@@ -909,7 +6138,7 @@ public:
         cout << "\nTotal rute langsung: " << neighbors.size() << endl;
     }
     
-    void displayPath(const vector<string>& path) {
+    void displayPath(const vector<string>& path) const {
         if (path.empty()) {
             cout << "Path tidak ditemukan!" << endl;
             return;
@@ -926,7 +6155,7 @@ public:
         cout << "Jumlah stops: " << (path.size() - 1) << endl;
     }
     
-    void displayStatistics() {
+    void displayStatistics() const {
         Statistics stats = getStatistics();
         
         cout << "\n========== STATISTIK GRAPH ==========" << endl;
@@ -942,9 +6171,207 @@ public:
     }
 };
 
-// ==================== HELPER FUNCTIONS ====================
+// ==================== BATCH QUERY ENGINE ====================
+
+// Algoritma yang bisa dipakai di batch query
+struct BatchQuery {
+    AirportId origin;
+    AirportId destination;
+    QueryAlgorithm algorithm;
+    
+    BatchQuery(AirportId o = AirportId(), AirportId d = AirportId(),
+               QueryAlgorithm a = QueryAlgorithm::DIJKSTRA)
+        : origin(o), destination(d), algorithm(a) {}
+};
+
+// Parse nama algoritma (DIJKSTRA, BFS, DFS, BIDIRECTIONAL, ASTAR/A*, ALT, CH), case-insensitive
+bool parseQueryAlgorithm(const string& name, QueryAlgorithm& algorithm) {
+    string upper = toUpperCase(trim(name));
+    if (upper.empty() || upper == "DIJKSTRA") algorithm = QueryAlgorithm::DIJKSTRA;
+    else if (upper == "BFS") algorithm = QueryAlgorithm::BFS;
+    else if (upper == "DFS") algorithm = QueryAlgorithm::DFS;
+    else if (upper == "BIDIRECTIONAL") algorithm = QueryAlgorithm::BIDIRECTIONAL;
+    else if (upper == "ASTAR" || upper == "A*") algorithm = QueryAlgorithm::ASTAR;
+    else if (upper == "ALT") algorithm = QueryAlgorithm::ALT;
+    else if (upper == "CH") algorithm = QueryAlgorithm::CH;
+    else return false;
+    return true;
+}
+
+const char* queryAlgorithmName(QueryAlgorithm algorithm) {
+    switch (algorithm) {
+        case QueryAlgorithm::BFS: return "BFS";
+        case QueryAlgorithm::DFS: return "DFS";
+        case QueryAlgorithm::BIDIRECTIONAL: return "BIDIRECTIONAL";
+        case QueryAlgorithm::ASTAR: return "ASTAR";
+        case QueryAlgorithm::ALT: return "ALT";
+        case QueryAlgorithm::CH: return "CH";
+        default: return "DIJKSTRA";
+    }
+}
+
+/**
+ * BatchQueryEngine - Menjalankan banyak query (asal, tujuan, algoritma) secara paralel
+ *
+ * Graph dipakai read-only: cache turunan (CH, landmark) dibangun sekali sebelum worker
+ * dijalankan, dan setiap worker punya SearchWorkspace sendiri. Worker mengambil blok query
+ * lewat counter atomic (load balancing dinamis) dan menulis hasil langsung ke slot index
+ * input, sehingga urutan hasil = urutan input.
+ * Setiap query membaca snapshot graph, jadi applyUpdates boleh berjalan bersamaan run();
+ * query yang dimulai setelah batch update selesai melihat versi baru.
+ */
+class BatchQueryEngine {
+private:
+    static const size_t BLOCK_SIZE = 64;   // Query per pengambilan dari counter atomic
+    
+    const FlightRouteGraph& graph;
+    int numThreads;
+    
+    PathResult runQuery(const BatchQuery& query, SearchWorkspace& ws) const {
+        AirportId from = query.origin, to = query.destination;
+        switch (query.algorithm) {
+            case QueryAlgorithm::BFS: return graph.findPathBFS(from, to, ws);
+            case QueryAlgorithm::DFS: return graph.findPathDFS(from, to, ws);
+            case QueryAlgorithm::BIDIRECTIONAL: return graph.findShortestPathBidirectional(from, to, ws);
+            case QueryAlgorithm::ASTAR: return graph.findShortestPathAStar(from, to, ws);
+            case QueryAlgorithm::ALT: return graph.findShortestPathALT(from, to, ws);
+            case QueryAlgorithm::CH: return graph.findShortestPathCH(from, to, ws);
+            default: return graph.findShortestPath(from, to, ws);
+        }
+    }
+
+public:
+    /**
+     * @param threads: Jumlah worker, 0 = otomatis (jumlah core)
+     */
+    explicit BatchQueryEngine(const FlightRouteGraph& g, int threads = 0)
+        : graph(g), numThreads(threads > 0 ? threads : (int)max(1u, thread::hardware_concurrency())) {}
+    
+    int threadCount() const { return numThreads; }
+    
+    /**
+     * run - Jalankan semua query secara paralel
+     * @return: PathResult per query, urutan sama dengan input
+     */
+    vector<PathResult> run(const vector<BatchQuery>& queries) const {
+        bool needCH = false, needLandmarks = false;
+        for (const BatchQuery& query : queries) {
+            needCH |= query.algorithm == QueryAlgorithm::CH;
+            needLandmarks |= query.algorithm == QueryAlgorithm::ALT;
+        }
+        graph.prepareConcurrentQueries(needCH, needLandmarks);
+        
+        vector<PathResult> results(queries.size());
+        atomic<size_t> nextBlock(0);
+        auto worker = [&]() {
+            SearchWorkspace workspace;   // Scratch per worker, dipakai ulang untuk semua query
+            while (true) {
+                size_t begin = nextBlock.fetch_add(BLOCK_SIZE);
+                if (begin >= queries.size()) {
+                    break;
+                }
+                size_t end = min(queries.size(), begin + BLOCK_SIZE);
+                for (size_t i = begin; i < end; i++) {
+                    results[i] = runQuery(queries[i], workspace);
+                }
+            }
+        };
+        
+        int workers = (int)min<size_t>(numThreads, (queries.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        if (workers <= 1) {
+            worker();
+        } else {
+            vector<thread> pool;
+            for (int i = 0; i < workers; i++) {
+                pool.emplace_back(worker);
+            }
+            for (thread& t : pool) {
+                t.join();
+            }
+        }
+        return results;
+    }
+    
+    /**
+     * loadQueries - Baca query dari file CSV: asal,tujuan[,algoritma]
+     * Baris kosong, komentar (#), dan header yang tidak valid dilewati.
+     * @return: false jika file tidak bisa dibuka
+     */
+    bool loadQueries(const string& filename, vector<BatchQuery>& queries) const {
+        MappedFile file;
+        if (!file.open(filename)) {
+            cerr << "Error: Tidak dapat membuka file " << filename << endl;
+            return false;
+        }
+        
+        const char* data = file.data();
+        size_t size = file.size();
+        size_t pos = 0;
+        int lineNumber = 0, skipped = 0;
+        vector<string_view> fields;
+        vector<string> slowFields;
+        
+        while (pos < size) {
+            const char* lineEnd = (const char*)memchr(data + pos, '\n', size - pos);
+            size_t lineLength = lineEnd ? (size_t)(lineEnd - (data + pos)) : size - pos;
+            string_view line(data + pos, lineLength);
+            pos += lineLength + 1;
+            lineNumber++;
+            
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            
+            splitCSVFields(line, fields, slowFields);
+            QueryAlgorithm algorithm = QueryAlgorithm::DIJKSTRA;
+            string origin = fields.size() >= 2 ? toUpperCase(trim(string(fields[0]))) : "";
+            string destination = fields.size() >= 2 ? toUpperCase(trim(string(fields[1]))) : "";
+            if (!isValidAirportCode(origin) || !isValidAirportCode(destination) ||
+                (fields.size() >= 3 && !parseQueryAlgorithm(string(fields[2]), algorithm))) {
+                if (lineNumber > 1) {   // Baris pertama yang tidak valid dianggap header
+                    skipped++;
+                }
+                continue;
+            }
+            queries.push_back(BatchQuery(AirportId::fromCode(origin), AirportId::fromCode(destination), algorithm));
+        }
+        
+        if (skipped > 0) {
+            cout << "Info: " << skipped << " baris query tidak valid dilewati" << endl;
+        }
+        return true;
+    }
+    
+    /**
+     * writeResults - Tulis hasil ke CSV: asal,tujuan,algoritma,found,jarak,stops,path
+     * @return: false jika file gagal ditulis
+     */
+    bool writeResults(const string& filename, const vector<BatchQuery>& queries,
+                      const vector<PathResult>& results) const {
+        ofstream out(filename);
+        if (!out.is_open()) {
+            cerr << "Error: Tidak dapat menulis file " << filename << endl;
+            return false;
+        }
+        
+        out << "origin,destination,algorithm,found,distance,stops,path\n";
+        for (size_t i = 0; i < queries.size() && i < results.size(); i++) {
+            const PathResult& r = results[i];
+            out << queries[i].origin.toCode() << ',' << queries[i].destination.toCode() << ','
+                << queryAlgorithmName(queries[i].algorithm) << ',' << (r.found ? 1 : 0) << ','
+                << (r.found ? r.totalDistance : -1) << ',' << (r.found ? r.stops : -1) << ',';
+            for (size_t k = 0; k < r.path.size(); k++) {
+                out << (k > 0 ? "-" : "") << r.path[k];
+            }
+            out << '\n';
+        }
+        return out.good();
+    }
+};
 
-// Helper function untuk convert string ke uppercase
 // ==================== HELPER FUNCTIONS ====================
 
 // Haversine formula untuk menghitung jarak antara dua koordinat
@@ -993,6 +6420,130 @@ vector<string> parseCSVLine(const string& line) {
     return fields;
 }
 
+// Split satu baris CSV menjadi string_view (zero-copy), semantik sama dengan parseCSVLine.
+// Field yang seluruhnya di dalam quote ("...") cukup di-view tanpa tanda quote;
+// hanya baris dengan quote di tengah field yang jatuh ke parseCSVLine (slowFields).
+void splitCSVFields(string_view line, vector<string_view>& fields, vector<string>& slowFields) {
+    fields.clear();
+    
+    size_t fieldStart = 0;
+    bool inQuotes = false;
+    bool needsSlowPath = false;
+    
+    for (size_t i = 0; i <= line.length(); i++) {
+        if (i < line.length()) {
+            char c = line[i];
+            if (c == '"') {
+                inQuotes = !inQuotes;
+                continue;
+            }
+            if (c != ',' || inQuotes) {
+                if (c == '\r' || c == '\n') {
+                    needsSlowPath = needsSlowPath || i + 1 < line.length();
+                }
+                continue;
+            }
+        }
+        
+        string_view field = line.substr(fieldStart, i - fieldStart);
+        if (!field.empty() && field.back() == '\r') {
+            field.remove_suffix(1);
+        }
+        if (field.length() >= 2 && field.front() == '"' && field.back() == '"') {
+            field = field.substr(1, field.length() - 2);
+        }
+        if (field.find('"') != string_view::npos) {
+            needsSlowPath = true;
+        }
+        fields.push_back(field);
+        fieldStart = i + 1;
+    }
+    
+    if (needsSlowPath) {
+        slowFields = parseCSVLine(string(line));
+        fields.assign(slowFields.begin(), slowFields.end());
+    }
+}
+
+// Parse integer dari field CSV, semantik sama dengan stoi (tanpa exception)
+bool parseIntField(string_view field, int& value) {
+    char buffer[64];
+    if (field.length() >= sizeof(buffer)) return false;
+    memcpy(buffer, field.data(), field.length());
+    buffer[field.length()] = '\0';
+    
+    char* endPtr;
+    errno = 0;
+    long parsed = strtol(buffer, &endPtr, 10);
+    if (endPtr == buffer || errno == ERANGE ||
+        parsed < numeric_limits<int>::min() || parsed > numeric_limits<int>::max()) {
+        return false;
+    }
+    value = (int)parsed;
+    return true;
+}
+
+// Parse double dari field CSV, semantik sama dengan stod (tanpa exception)
+bool parseDoubleField(string_view field, double& value) {
+    char buffer[64];
+    if (field.length() >= sizeof(buffer)) return false;
+    memcpy(buffer, field.data(), field.length());
+    buffer[field.length()] = '\0';
+    
+    char* endPtr;
+    errno = 0;
+    double parsed = strtod(buffer, &endPtr);
+    if (endPtr == buffer || errno == ERANGE) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// Checksum 64-bit (FNV-1a per 8 byte) untuk validasi file snapshot
+uint64_t computeChecksum(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Ambil ukuran dan waktu modifikasi file, return false jika file tidak ada
+bool getFileStamp(const string& filename, uint64_t& size, int64_t& modifiedTime) {
+    size = 0;
+    modifiedTime = 0;
+    if (filename.empty()) return false;
+    
+    error_code ec;
+    uintmax_t fileSize = filesystem::file_size(filename, ec);
+    if (ec) return false;
+    auto writeTime = filesystem::last_write_time(filename, ec);
+    if (ec) return false;
+    
+    size = fileSize;
+    modifiedTime = writeTime.time_since_epoch().count();
+    return true;
+}
+
+// Tampilkan throughput loader (bytes/detik dan baris/detik)
+void printLoadStats(const string& filename, const LoadStats& stats) {
+    double seconds = max(stats.seconds, 1e-9);
+    ostringstream info;
+    info << fixed << setprecision(2)
+         << "Info: " << filename << ": " << stats.rows << " baris, "
+         << (stats.bytes / 1048576.0) << " MB dalam " << (stats.seconds * 1000.0) << " ms ("
+         << (stats.bytes / 1048576.0 / seconds) << " MB/s, "
+         << (stats.rows / seconds / 1e6) << " juta baris/s)";
+    cout << info.str() << endl;
+}
+
 string toUpperCase(string str) {
     transform(str.begin(), str.end(), str.begin(), ::toupper);
     return str;
@@ -1017,6 +6568,9 @@ bool isValidAirportCode(const string& code) {
 
 // ==================== MENU SYSTEM ====================
 
+// Nomor menu terbesar yang valid
+const int MAX_MENU_CHOICE = 29;
+
 void displayMenu() {
     cout << "\n========================================" << endl;
     cout << "   SISTEM PENCARIAN RUTE PENERBANGAN" << endl;
@@ -1037,6 +6591,19 @@ void displayMenu() {
     cout << "14. Cari semua path dengan max stops" << endl;
     cout << "15. Tampilkan statistik graph" << endl;
     cout << "16. Hapus rute (removeEdge)" << endl;
+    cout << "17. Benchmark shortest path (Dijkstra vs varian cepat)" << endl;
+    cout << "18. Cari shortest path (A* great-circle)" << endl;
+    cout << "19. Bangun Contraction Hierarchy + verifikasi" << endl;
+    cout << "20. Cari shortest path (ALT landmark)" << endl;
+    cout << "21. Batch query paralel (file / pasangan acak)" << endl;
+    cout << "22. Hitung distance matrix (ke file biner)" << endl;
+    cout << "23. Matriks minimum stops semua pasangan (bit-parallel BFS)" << endl;
+    cout << "24. Cari K rute alternatif terpendek (Yen)" << endl;
+    cout << "25. Hitung semua path: sekuensial vs paralel" << endl;
+    cout << "26. Benchmark priority queue Dijkstra (binary/radix/Dial/4-ary)" << endl;
+    cout << "27. Cache shortest-path tree untuk bandara hub" << endl;
+    cout << "28. Cache hasil query (LRU) + statistik hit/miss" << endl;
+    cout << "29. Snapshot MVCC: update rute selama query paralel" << endl;
     cout << "0. Keluar" << endl;
     cout << "========================================" << endl;
     cout << "Pilihan: ";
@@ -1081,7 +6648,7 @@ int main() {
         
         if (!isNumber) {
             cout << "\n❌ Input tidak valid!" << endl;
-            cout << "⚠️  Masukkan pilihan angka yang sesuai dengan menu yang tersedia (0-16)." << endl;
+            cout << "⚠️  Masukkan pilihan angka yang sesuai dengan menu yang tersedia (0-" << MAX_MENU_CHOICE << ")." << endl;
             cout << "\nTekan Enter untuk melanjutkan...";
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
             continue;
@@ -1092,16 +6659,16 @@ int main() {
             choice = stoi(input);
         } catch (...) {
             cout << "\n❌ Input tidak valid!" << endl;
-            cout << "⚠️  Masukkan pilihan angka yang sesuai dengan menu yang tersedia (0-16)." << endl;
+            cout << "⚠️  Masukkan pilihan angka yang sesuai dengan menu yang tersedia (0-" << MAX_MENU_CHOICE << ")." << endl;
             cout << "\nTekan Enter untuk melanjutkan...";
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
             continue;
         }
         
         // Validate range
-        if (choice < 0 || choice > 16) {
+        if (choice < 0 || choice > MAX_MENU_CHOICE) {
             cout << "\n❌ Pilihan tidak valid!" << endl;
-            cout << "⚠️  Pilihan harus antara 0-16. Silakan pilih menu yang tersedia." << endl;
+            cout << "⚠️  Pilihan harus antara 0-" << MAX_MENU_CHOICE << ". Silakan pilih menu yang tersedia." << endl;
             cout << "\nTekan Enter untuk melanjutkan...";
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
             continue;
@@ -1149,7 +6716,7 @@ int main() {
                 testRoutes.close();
                 
                 cout << "\n" << string(60, '=') << endl;
-                auto result = graph.loadDataset(airportsFile, routesFile);
+                auto result = graph.loadDataset(airportsFile, routesFile, routesFile + ".snap");
                 cout << string(60, '=') << endl;
                 
                 if (result.first > 0 && result.second > 0) {
@@ -1157,6 +6724,13 @@ int main() {
                     cout << "   Airports: " << result.first << " bandara" << endl;
                     cout << "   Routes:   " << result.second << " rute" << endl;
                     dataLoaded = true;
+                    
+                    // Tabel landmark ALT: pakai file jika masih cocok dengan graph, jika tidak bangun ulang
+                    string landmarkFile = routesFile + ".lmk";
+                    if (!graph.loadLandmarks(landmarkFile)) {
+                        graph.buildLandmarks();
+                        graph.saveLandmarks(landmarkFile);
+                    }
                 } else {
                     cout << "\n✗ Gagal memuat data!" << endl;
                 }
@@ -1252,186 +6826,570 @@ int main() {
                     cout << "   Nama: " << info.name << endl;
                     cout << "   ID: " << info.id << endl;
                 } else {
-                    cout << "\n✗ Bandara " << code << " TIDAK ADA dalam database!" << endl;
+                    cout << "\n✗ Bandara " << code << " TIDAK ADA dalam database!" << endl;
+                }
+                break;
+            }
+            
+            case 5: {  // hasEdge
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string from, to;
+                cout << "\n=== CEK RUTE EXIST ===" << endl;
+                cout << "Bandara asal: ";
+                getline(cin, from);
+                cout << "Bandara tujuan: ";
+                getline(cin, to);
+                
+                from = toUpperCase(trim(from));
+                to = toUpperCase(trim(to));
+                
+                if (from.empty() || to.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(from) || !isValidAirportCode(to)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                
+                if (graph.hasEdge(from, to)) {
+                    cout << "\n✓ Rute " << from << " → " << to << " ADA!" << endl;
+                    
+                    // Show details
+                    vector<Route> routes = graph.getNeighbors(from);
+                    cout << "\nDetail rute:" << endl;
+                    cout << "Tujuan\t\tJarak\t\tMaskapai" << endl;
+                    cout << "================================================" << endl;
+                    for (const Route& r : routes) {
+                        if (r.destination == to) {
+                            cout << r.destination << "\t\t" 
+                                 << r.distance << " km\t\t" 
+                                 << r.airline << endl;
+                        }
+                    }
+                } else {
+                    cout << "\n✗ Rute " << from << " → " << to << " TIDAK ADA!" << endl;
+                    cout << "💡 Tip: Gunakan Menu 2 untuk melihat semua rute dari " << from << endl;
+                }
+                break;
+            }
+
+            case 6: { // indegree
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string code;
+                cout << "\n=== HITUNG INDEGREE ===" << endl;
+                cout << "Kode bandara: ";
+                getline(cin, code);
+                
+                code = toUpperCase(trim(code));
+                if (code.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(code)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(code, "Bandara")) break;
+                
+                int inDeg = graph.indegree(code);
+                if (inDeg >= 0) {
+                    cout << "\n📥 INDEGREE " << code << ": " << inDeg << " rute" << endl;
+                    cout << "   → Jumlah penerbangan yang MENUJU ke " << code << endl;
+                    
+                    if (inDeg == 0) {
+                        cout << "\n⚠️  Tidak ada penerbangan yang menuju " << code << "!" << endl;
+                        cout << "   (Source node / isolated node)" << endl;
+                    } else if (inDeg > 50) {
+                        cout << "\n🌟 " << code << " adalah bandara POPULER (banyak penerbangan masuk)!" << endl;
+                    }
+                    
+                    // Tampilkan bandara asal (predecessor) dari reverse index
+                    if (inDeg > 0) {
+                        set<string> origins;
+                        for (const IncomingRoute& r : graph.getIncoming(code)) {
+                            origins.insert(r.origin);
+                        }
+                        cout << "\nBandara asal (" << origins.size() << " unik): ";
+                        size_t shown = 0;
+                        for (const string& origin : origins) {
+                            if (shown == 20) {
+                                cout << " ...";
+                                break;
+                            }
+                            cout << (shown > 0 ? ", " : "") << origin;
+                            shown++;
+                        }
+                        cout << endl;
+                    }
+                }
+                break;
+            }
+            
+            case 7: {  // outdegree
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string code;
+                cout << "\n=== HITUNG OUTDEGREE ===" << endl;
+                cout << "Kode bandara: ";
+                getline(cin, code);
+                
+                code = toUpperCase(trim(code));
+                if (code.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(code)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(code, "Bandara")) break;
+                
+                int outDeg = graph.outdegree(code);
+                if (outDeg >= 0) {
+                    cout << "\n📤 OUTDEGREE " << code << ": " << outDeg << " rute" << endl;
+                    cout << "   → Jumlah penerbangan yang BERANGKAT dari " << code << endl;
+                    
+                    if (outDeg == 0) {
+                        cout << "\n⚠️  Tidak ada penerbangan yang berangkat dari " << code << "!" << endl;
+                        cout << "   (Sink node / destination only)" << endl;
+                    } else if (outDeg > 50) {
+                        cout << "\n🌟 " << code << " adalah HUB besar (banyak tujuan)!" << endl;
+                    }
+                    
+                    // Show indegree juga untuk comparison
+                    int inDeg = graph.indegree(code);
+                    cout << "\n📊 Comparison:" << endl;
+                    cout << "   Indegree:  " << inDeg << " (incoming)" << endl;
+                    cout << "   Outdegree: " << outDeg << " (outgoing)" << endl;
+                    cout << "   Total degree: " << (inDeg + outDeg) << endl;
+                }
+                break;
+            }
+            
+            case 8: {
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                string start, end;
+                cout << "Bandara asal: ";
+                getline(cin, start);
+                cout << "Bandara tujuan: ";
+                getline(cin, end);
+                
+                // Trim and validate
+                start = trim(start);
+                end = trim(end);
+                
+                if (start.empty() || end.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                
+                // Convert to uppercase
+                start = toUpperCase(start);
+                end = toUpperCase(end);
+                
+                // Validate format
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf! Contoh: CGK, SIN, DPS" << endl;
+                    break;
+                }
+                
+                // Check if exists using class function
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
+                
+                PathResult result = graph.findPathBFS(start, end);
+                cout << "\n=== HASIL PENCARIAN BFS ===" << endl;
+                cout << "Algoritma: " << result.algorithm << endl;
+                if (result.found) {
+                    graph.displayPath(result.path);
+                    cout << "Total jarak: " << result.totalDistance << " km" << endl;
+                } else {
+                    cout << "Path tidak ditemukan!" << endl;
+                }
+                break;
+            }
+            
+            case 9: {
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                string start, end;
+                cout << "Bandara asal: ";
+                getline(cin, start);
+                cout << "Bandara tujuan: ";
+                getline(cin, end);
+                
+                start = toUpperCase(trim(start));
+                end = toUpperCase(trim(end));
+                
+                if (start.empty() || end.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
+                
+                PathResult result = graph.findPathDFS(start, end);
+                cout << "\n=== HASIL PENCARIAN DFS ===" << endl;
+                cout << "Algoritma: " << result.algorithm << endl;
+                if (result.found) {
+                    graph.displayPath(result.path);
+                    cout << "Total jarak: " << result.totalDistance << " km" << endl;
+                } else {
+                    cout << "Path tidak ditemukan!" << endl;
+                }
+                break;
+            }
+            
+            case 10: {
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                string start, end;
+                cout << "Bandara asal: ";
+                getline(cin, start);
+                cout << "Bandara tujuan: ";
+                getline(cin, end);
+                
+                start = toUpperCase(trim(start));
+                end = toUpperCase(trim(end));
+                
+                if (start.empty() || end.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
+                
+                PathResult result = graph.findShortestPath(start, end);
+                cout << "\n=== HASIL PENCARIAN DIJKSTRA ===" << endl;
+                cout << "Algoritma: " << result.algorithm << endl;
+                if (result.found) {
+                    graph.displayPath(result.path);
+                    cout << "Total jarak: " << result.totalDistance << " km" << endl;
+                    
+                    int flightTime = result.totalDistance / 800;
+                    int transitTime = result.stops * 2;
+                    cout << "Estimasi waktu terbang: ~" << flightTime << " jam" << endl;
+                    cout << "Estimasi waktu transit: ~" << transitTime << " jam" << endl;
+                    cout << "Total estimasi: ~" << (flightTime + transitTime) << " jam" << endl;
+                } else {
+                    cout << "Path tidak ditemukan!" << endl;
                 }
                 break;
             }
             
-            case 5: {  // hasEdge
+            case 11: {
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                
-                string from, to;
-                cout << "\n=== CEK RUTE EXIST ===" << endl;
+                string start, end;
+                cout << "\n=== PERBANDINGAN ALGORITMA ===" << endl;
                 cout << "Bandara asal: ";
-                getline(cin, from);
+                getline(cin, start);
                 cout << "Bandara tujuan: ";
-                getline(cin, to);
+                getline(cin, end);
                 
-                from = toUpperCase(trim(from));
-                to = toUpperCase(trim(to));
+                start = toUpperCase(trim(start));
+                end = toUpperCase(trim(end));
                 
-                if (from.empty() || to.empty()) {
+                if (start.empty() || end.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
-                if (!isValidAirportCode(from) || !isValidAirportCode(to)) {
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
                     cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
                     break;
                 }
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                if (graph.hasEdge(from, to)) {
-                    cout << "\n✓ Rute " << from << " → " << to << " ADA!" << endl;
-                    
-                    // Show details
-                    vector<Route> routes = graph.getNeighbors(from);
-                    cout << "\nDetail rute:" << endl;
-                    cout << "Tujuan\t\tJarak\t\tMaskapai" << endl;
-                    cout << "================================================" << endl;
-                    for (const Route& r : routes) {
-                        if (r.destination == to) {
-                            cout << r.destination << "\t\t" 
-                                 << r.distance << " km\t\t" 
-                                 << r.airline << endl;
-                        }
-                    }
-                } else {
-                    cout << "\n✗ Rute " << from << " → " << to << " TIDAK ADA!" << endl;
-                    cout << "💡 Tip: Gunakan Menu 2 untuk melihat semua rute dari " << from << endl;
-                }
+                graph.comparePathFindingAlgorithms(start, end);
                 break;
             }
-
-            case 6: { // indegree
+            
+            case 12: {  
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
+                string start;
+                cout << "Bandara awal: ";
+                getline(cin, start);
                 
-                string code;
-                cout << "\n=== HITUNG INDEGREE ===" << endl;
-                cout << "Kode bandara: ";
-                getline(cin, code);
-                
-                code = toUpperCase(trim(code));
-                if (code.empty()) {
+                start = toUpperCase(trim(start));
+                if (start.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
-                if (!isValidAirportCode(code)) {
+                if (!isValidAirportCode(start)) {
                     cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
                     break;
                 }
-                if (!graph.validateAirportInput(code, "Bandara")) break;
+                if (!graph.validateAirportInput(start, "Bandara")) break;
                 
-                int inDeg = graph.indegree(code);
-                if (inDeg >= 0) {
-                    cout << "\n📥 INDEGREE " << code << ": " << inDeg << " rute" << endl;
-                    cout << "   → Jumlah penerbangan yang MENUJU ke " << code << endl;
-                    
-                    if (inDeg == 0) {
-                        cout << "\n⚠️  Tidak ada penerbangan yang menuju " << code << "!" << endl;
-                        cout << "   (Source node / isolated node)" << endl;
-                    } else if (inDeg > 50) {
-                        cout << "\n🌟 " << code << " adalah bandara POPULER (banyak penerbangan masuk)!" << endl;
-                    }
+                vector<string> traversal = graph.traverse(start, "BFS");
+                cout << "\nBFS Traversal dari " << start << ":" << endl;
+                cout << "Bandara yang dapat dijangkau: " << traversal.size() << endl;
+                cout << "Urutan: ";
+                for (size_t i = 0; i < min(traversal.size(), size_t(20)); i++) {
+                    cout << traversal[i];
+                    if (i < min(traversal.size(), size_t(20)) - 1) cout << ", ";
                 }
+                if (traversal.size() > 20) cout << " ...";
+                cout << endl;
                 break;
             }
             
-            case 7: {  // outdegree
+            case 13: {  
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
+                string start;
+                cout << "Bandara awal: ";
+                getline(cin, start);
                 
-                string code;
-                cout << "\n=== HITUNG OUTDEGREE ===" << endl;
-                cout << "Kode bandara: ";
-                getline(cin, code);
-                
-                code = toUpperCase(trim(code));
-                if (code.empty()) {
+                start = toUpperCase(trim(start));
+                if (start.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
-                if (!isValidAirportCode(code)) {
+                if (!isValidAirportCode(start)) {
                     cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
                     break;
                 }
-                if (!graph.validateAirportInput(code, "Bandara")) break;
+                if (!graph.validateAirportInput(start, "Bandara")) break;
                 
-                int outDeg = graph.outdegree(code);
-                if (outDeg >= 0) {
-                    cout << "\n📤 OUTDEGREE " << code << ": " << outDeg << " rute" << endl;
-                    cout << "   → Jumlah penerbangan yang BERANGKAT dari " << code << endl;
-                    
-                    if (outDeg == 0) {
-                        cout << "\n⚠️  Tidak ada penerbangan yang berangkat dari " << code << "!" << endl;
-                        cout << "   (Sink node / destination only)" << endl;
-                    } else if (outDeg > 50) {
-                        cout << "\n🌟 " << code << " adalah HUB besar (banyak tujuan)!" << endl;
-                    }
-                    
-                    // Show indegree juga untuk comparison
-                    int inDeg = graph.indegree(code);
-                    cout << "\n📊 Comparison:" << endl;
-                    cout << "   Indegree:  " << inDeg << " (incoming)" << endl;
-                    cout << "   Outdegree: " << outDeg << " (outgoing)" << endl;
-                    cout << "   Total degree: " << (inDeg + outDeg) << endl;
+                vector<string> traversal = graph.traverse(start, "DFS");
+                cout << "\nDFS Traversal dari " << start << ":" << endl;
+                cout << "Bandara yang dapat dijangkau: " << traversal.size() << endl;
+                cout << "Urutan: ";
+                for (size_t i = 0; i < min(traversal.size(), size_t(20)); i++) {
+                    cout << traversal[i];
+                    if (i < min(traversal.size(), size_t(20)) - 1) cout << ", ";
                 }
+                if (traversal.size() > 20) cout << " ...";
+                cout << endl;
                 break;
             }
             
-            case 8: {
+            case 14: {  
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                string start, end;
+                string start, end, maxStopsStr;
+                int maxStops;
+                
                 cout << "Bandara asal: ";
                 getline(cin, start);
                 cout << "Bandara tujuan: ";
                 getline(cin, end);
+                cout << "Maksimal stops: ";
+                getline(cin, maxStopsStr);
                 
-                // Trim and validate
-                start = trim(start);
-                end = trim(end);
+                start = toUpperCase(trim(start));
+                end = toUpperCase(trim(end));
+                maxStopsStr = trim(maxStopsStr);
                 
                 if (start.empty() || end.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
                 
-                // Convert to uppercase
-                start = toUpperCase(start);
-                end = toUpperCase(end);
+                // Validate maxStops input
+                if (maxStopsStr.empty()) {
+                    cout << "\n✗ Input maksimal stops tidak boleh kosong!" << endl;
+                    break;
+                }
                 
-                // Validate format
-                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
-                    cout << "\n✗ Kode bandara harus 3 huruf! Contoh: CGK, SIN, DPS" << endl;
+                // Check if maxStops is numeric
+                bool isNumeric = true;
+                for (char c : maxStopsStr) {
+                    if (!isdigit(c)) {
+                        isNumeric = false;
+                        break;
+                    }
+                }
+                
+                if (!isNumeric) {
+                    cout << "\n✗ Maksimal stops harus berupa angka!" << endl;
+                    cout << "💡 Contoh: 3, 5, 10" << endl;
                     break;
                 }
                 
-                // Check if exists using class function
+                // Convert to integer
+                try {
+                    maxStops = stoi(maxStopsStr);
+                } catch (...) {
+                    cout << "\n✗ Input tidak valid!" << endl;
+                    break;
+                }
+                
+                if (maxStops < 1 || maxStops > 10) {
+                    cout << "\n✗ Max stops harus antara 1-10!" << endl;
+                    break;
+                }
                 if (!graph.validateAirportInput(start, "Bandara asal")) break;
                 if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                PathResult result = graph.findPathBFS(start, end);
-                cout << "\n=== HASIL PENCARIAN BFS ===" << endl;
-                cout << "Algoritma: " << result.algorithm << endl;
-                if (result.found) {
-                    graph.displayPath(result.path);
-                    cout << "Total jarak: " << result.totalDistance << " km" << endl;
+                // Kasus umum: rute terpendek dalam batas stops, tanpa enumerasi
+                PathResult bestRoute = graph.findShortestPathWithMaxStops(start, end, maxStops);
+                if (!bestRoute.found) {
+                    cout << "\nTidak ada rute dengan maksimal " << maxStops << " stops!" << endl;
+                    break;
+                }
+                cout << "\n✈ Rute terpendek (maks " << maxStops << " stops): "
+                     << bestRoute.totalDistance << " km" << endl;
+                graph.displayPath(bestRoute.path);
+                
+                // Streaming: hanya 10 path pertama yang disimpan, sisanya dihitung
+                const size_t DISPLAY_LIMIT = 10;
+                const double TIME_BUDGET_MS = 10000;
+                vector<vector<string>> firstPaths;
+                PathEnumerationStats stats = graph.findAllPaths(start, end, maxStops,
+                    [&firstPaths, DISPLAY_LIMIT](const vector<string>& path) {
+                        if (firstPaths.size() < DISPLAY_LIMIT) {
+                            firstPaths.push_back(path);
+                        }
+                        return true;
+                    },
+                    PathEnumerationLimits(0, TIME_BUDGET_MS));
+                
+                cout << "\nDitemukan " << stats.pathsFound << " path:" << endl;
+                for (size_t i = 0; i < firstPaths.size(); i++) {
+                    cout << (i + 1) << ". ";
+                    graph.displayPath(firstPaths[i]);
+                }
+                if (stats.pathsFound > firstPaths.size()) {
+                    cout << "... dan " << (stats.pathsFound - firstPaths.size()) << " path lainnya" << endl;
+                }
+                if (stats.timedOut) {
+                    cout << "⚠ Enumerasi dihentikan setelah " << (int)(TIME_BUDGET_MS / 1000)
+                         << " detik, jumlah path belum lengkap" << endl;
+                }
+                break;
+            }
+            
+            case 15: {  
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                graph.displayStatistics();
+                break;
+            }
+            
+            case 16: {  // removeEdge
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string from, to;
+                cout << "\n=== HAPUS RUTE ===" << endl;
+                cout << "Bandara asal: ";
+                getline(cin, from);
+                cout << "Bandara tujuan: ";
+                getline(cin, to);
+                
+                from = toUpperCase(trim(from));
+                to = toUpperCase(trim(to));
+                
+                if (from.empty() || to.empty()) {
+                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                    break;
+                }
+                if (!isValidAirportCode(from) || !isValidAirportCode(to)) {
+                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                    break;
+                }
+                
+                // Show existing routes before removal
+                if (graph.hasEdge(from, to)) {
+                    vector<Route> routes = graph.getNeighbors(from);
+                    int count = 0;
+                    for (const Route& r : routes) {
+                        if (r.destination == to) count++;
+                    }
+                    cout << "\nDitemukan " << count << " rute dari " << from << " → " << to << endl;
+                }
+                
+                bool success = graph.removeEdge(from, to);
+                if (success) {
+                    cout << "\n✓ Rute " << from << " → " << to << " berhasil dihapus!" << endl;
+                    cout << "💡 Note: Semua rute dengan airlines berbeda juga terhapus." << endl;
+                    if (graph.hasHubAirports()) {
+                        graph.buildHubTrees();
+                    }
                 } else {
-                    cout << "Path tidak ditemukan!" << endl;
+                    cout << "\n✗ Gagal menghapus rute." << endl;
+                }
+                break;
+            }
+            
+            case 17: {  // Benchmark shortest path
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string pairsStr;
+                cout << "\n=== BENCHMARK SHORTEST PATH ===" << endl;
+                cout << "Jumlah pasangan acak [200]: ";
+                getline(cin, pairsStr);
+                pairsStr = trim(pairsStr);
+                
+                int randomPairs = 200;
+                if (!pairsStr.empty()) {
+                    bool isNumeric = all_of(pairsStr.begin(), pairsStr.end(), ::isdigit);
+                    if (!isNumeric || pairsStr.length() > 6) {
+                        cout << "\n✗ Jumlah pasangan harus berupa angka (1-100000)!" << endl;
+                        break;
+                    }
+                    randomPairs = stoi(pairsStr);
+                }
+                if (randomPairs < 1 || randomPairs > 100000) {
+                    cout << "\n✗ Jumlah pasangan harus antara 1-100000!" << endl;
+                    break;
                 }
+                
+                graph.benchmarkShortestPath(randomPairs);
                 break;
             }
             
-            case 9: {
+            case 18: {  // A* dengan heuristic great-circle
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
@@ -1456,8 +7414,9 @@ int main() {
                 if (!graph.validateAirportInput(start, "Bandara asal")) break;
                 if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                PathResult result = graph.findPathDFS(start, end);
-                cout << "\n=== HASIL PENCARIAN DFS ===" << endl;
+                PathResult result = graph.findShortestPathAStar(start, end);
+                PathResult reference = graph.findShortestPath(start, end);
+                cout << "\n=== HASIL PENCARIAN A* ===" << endl;
                 cout << "Algoritma: " << result.algorithm << endl;
                 if (result.found) {
                     graph.displayPath(result.path);
@@ -1465,10 +7424,48 @@ int main() {
                 } else {
                     cout << "Path tidak ditemukan!" << endl;
                 }
+                cout << "Node di-expand: " << result.expandedNodes
+                     << " (Dijkstra: " << reference.expandedNodes << ")" << endl;
+                if (reference.expandedNodes > 0) {
+                    cout << "Ruang pencarian: " << fixed << setprecision(1)
+                         << (100.0 * result.expandedNodes / reference.expandedNodes) << "% dari Dijkstra" << endl;
+                    cout.unsetf(ios::fixed);
+                }
                 break;
             }
             
-            case 10: {
+            case 19: {  // Contraction Hierarchies
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
+                    break;
+                }
+                
+                string pairsStr;
+                cout << "\n=== CONTRACTION HIERARCHIES ===" << endl;
+                cout << "Jumlah pasangan acak untuk verifikasi [1000]: ";
+                getline(cin, pairsStr);
+                pairsStr = trim(pairsStr);
+                
+                int randomPairs = 1000;
+                if (!pairsStr.empty()) {
+                    bool isNumeric = all_of(pairsStr.begin(), pairsStr.end(), ::isdigit);
+                    if (!isNumeric || pairsStr.length() > 6) {
+                        cout << "\n✗ Jumlah pasangan harus berupa angka (1-100000)!" << endl;
+                        break;
+                    }
+                    randomPairs = stoi(pairsStr);
+                }
+                if (randomPairs < 1 || randomPairs > 100000) {
+                    cout << "\n✗ Jumlah pasangan harus antara 1-100000!" << endl;
+                    break;
+                }
+                
+                graph.buildContractionHierarchy();
+                graph.verifyContractionHierarchy(randomPairs);
+                break;
+            }
+            
+            case 20: {  // ALT (A* + landmark)
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
@@ -1493,128 +7490,260 @@ int main() {
                 if (!graph.validateAirportInput(start, "Bandara asal")) break;
                 if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                PathResult result = graph.findShortestPath(start, end);
-                cout << "\n=== HASIL PENCARIAN DIJKSTRA ===" << endl;
+                PathResult result = graph.findShortestPathALT(start, end);
+                PathResult reference = graph.findShortestPath(start, end);
+                cout << "\n=== HASIL PENCARIAN ALT ===" << endl;
                 cout << "Algoritma: " << result.algorithm << endl;
                 if (result.found) {
                     graph.displayPath(result.path);
                     cout << "Total jarak: " << result.totalDistance << " km" << endl;
-                    
-                    int flightTime = result.totalDistance / 800;
-                    int transitTime = result.stops * 2;
-                    cout << "Estimasi waktu terbang: ~" << flightTime << " jam" << endl;
-                    cout << "Estimasi waktu transit: ~" << transitTime << " jam" << endl;
-                    cout << "Total estimasi: ~" << (flightTime + transitTime) << " jam" << endl;
                 } else {
                     cout << "Path tidak ditemukan!" << endl;
                 }
+                cout << "Node di-expand: " << result.expandedNodes
+                     << " (Dijkstra: " << reference.expandedNodes << ")" << endl;
                 break;
             }
             
-            case 11: {
+            case 21: {  // Batch query paralel
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                string start, end;
-                cout << "\n=== PERBANDINGAN ALGORITMA ===" << endl;
-                cout << "Bandara asal: ";
-                getline(cin, start);
-                cout << "Bandara tujuan: ";
-                getline(cin, end);
                 
-                start = toUpperCase(trim(start));
-                end = toUpperCase(trim(end));
+                string queryFile;
+                cout << "\n=== BATCH QUERY PARALEL ===" << endl;
+                cout << "File query CSV (asal,tujuan[,algoritma]) [kosong = 20000 pasangan acak]: ";
+                getline(cin, queryFile);
+                queryFile = trim(queryFile);
                 
-                if (start.empty() || end.empty()) {
-                    cout << "\n✗ Input tidak boleh kosong!" << endl;
+                BatchQueryEngine engine(graph);
+                vector<BatchQuery> queries;
+                if (!queryFile.empty()) {
+                    if (!engine.loadQueries(queryFile, queries)) break;
+                    if (queries.empty()) {
+                        cout << "\n✗ Tidak ada query valid di file!" << endl;
+                        break;
+                    }
+                    
+                    string outputFile;
+                    cout << "File hasil [batch_results.csv]: ";
+                    getline(cin, outputFile);
+                    outputFile = trim(outputFile);
+                    if (outputFile.empty()) {
+                        outputFile = "batch_results.csv";
+                    }
+                    
+                    auto startTime = chrono::steady_clock::now();
+                    vector<PathResult> results = engine.run(queries);
+                    double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                    
+                    int found = count_if(results.begin(), results.end(), [](const PathResult& r) { return r.found; });
+                    cout << "\n✓ " << queries.size() << " query selesai (" << found << " ditemukan) dengan "
+                         << engine.threadCount() << " thread, " << fixed << setprecision(1)
+                         << seconds * 1000 << " ms (" << setprecision(0) << queries.size() / max(seconds, 1e-9)
+                         << " query/s)" << endl;
+                    if (engine.writeResults(outputFile, queries, results)) {
+                        cout << "✓ Hasil ditulis ke " << outputFile << endl;
+                    }
                     break;
                 }
-                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
-                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
-                    break;
+                
+                // Tanpa file: bandingkan 1 thread vs semua core pada pasangan acak
+                for (const auto& pair : graph.randomAirportPairs(20000, 2024)) {
+                    queries.push_back(BatchQuery(pair.first, pair.second, QueryAlgorithm::DIJKSTRA));
                 }
-                if (!graph.validateAirportInput(start, "Bandara asal")) break;
-                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                graph.comparePathFindingAlgorithms(start, end);
+                BatchQueryEngine serialEngine(graph, 1);
+                auto startTime = chrono::steady_clock::now();
+                vector<PathResult> serialResults = serialEngine.run(queries);
+                double serialSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                
+                startTime = chrono::steady_clock::now();
+                vector<PathResult> parallelResults = engine.run(queries);
+                double parallelSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                
+                int mismatches = 0;
+                for (size_t i = 0; i < queries.size(); i++) {
+                    if (serialResults[i].totalDistance != parallelResults[i].totalDistance ||
+                        serialResults[i].path != parallelResults[i].path) {
+                        mismatches++;
+                    }
+                }
+                
+                cout << fixed << setprecision(0);
+                cout << "1 thread : " << serialSeconds * 1000 << " ms ("
+                     << queries.size() / max(serialSeconds, 1e-9) << " query/s)" << endl;
+                cout << engine.threadCount() << " thread : " << parallelSeconds * 1000 << " ms ("
+                     << queries.size() / max(parallelSeconds, 1e-9) << " query/s)" << endl;
+                cout << "Speedup  : " << setprecision(2) << serialSeconds / max(parallelSeconds, 1e-9)
+                     << "x, hasil berbeda: " << mismatches << endl;
                 break;
             }
             
-            case 12: {  
+            case 22: {  // Distance matrix
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                string start;
-                cout << "Bandara awal: ";
-                getline(cin, start);
                 
-                start = toUpperCase(trim(start));
-                if (start.empty()) {
-                    cout << "\n✗ Input tidak boleh kosong!" << endl;
-                    break;
+                string sourceList, outputFile;
+                cout << "\n=== DISTANCE MATRIX ===" << endl;
+                cout << "Bandara asal (pisahkan dengan koma) [kosong = semua]: ";
+                getline(cin, sourceList);
+                cout << "File output [distance_matrix.bin]: ";
+                getline(cin, outputFile);
+                outputFile = trim(outputFile);
+                if (outputFile.empty()) {
+                    outputFile = "distance_matrix.bin";
                 }
-                if (!isValidAirportCode(start)) {
-                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                
+                vector<AirportId> sources;
+                bool validInput = true;
+                stringstream ss(sourceList);
+                string code;
+                while (getline(ss, code, ',')) {
+                    code = toUpperCase(trim(code));
+                    if (code.empty()) continue;
+                    if (!isValidAirportCode(code) || !graph.validateAirportInput(code, "Bandara asal")) {
+                        validInput = false;
+                        break;
+                    }
+                    sources.push_back(AirportId::fromCode(code));
+                }
+                if (!validInput) break;
+                const vector<AirportId>& allAirports = graph.getAllAirportIds();
+                if (sources.empty()) {
+                    sources = allAirports;
+                }
+                
+                auto startTime = chrono::steady_clock::now();
+                bool written = graph.writeDistanceMatrix(outputFile, sources, allAirports);
+                double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                if (written) {
+                    double megabytes = sources.size() * allAirports.size() * 6.0 / (1024 * 1024);
+                    cout << "\n✓ Matriks " << sources.size() << " x " << allAirports.size() << " ditulis ke "
+                         << outputFile << " (" << fixed << setprecision(1) << megabytes << " MB) dalam "
+                         << setprecision(2) << seconds << " detik" << endl;
+                }
+                break;
+            }
+            
+            case 23: {  // All-pairs hop matrix
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                if (!graph.validateAirportInput(start, "Bandara")) break;
                 
-                vector<string> traversal = graph.traverse(start, "BFS");
-                cout << "\nBFS Traversal dari " << start << ":" << endl;
-                cout << "Bandara yang dapat dijangkau: " << traversal.size() << endl;
-                cout << "Urutan: ";
-                for (size_t i = 0; i < min(traversal.size(), size_t(20)); i++) {
-                    cout << traversal[i];
-                    if (i < min(traversal.size(), size_t(20)) - 1) cout << ", ";
+                const vector<AirportId>& allAirports = graph.getAllAirportIds();
+                cout << "\n=== MATRIKS MINIMUM STOPS (BIT-PARALLEL BFS) ===" << endl;
+                
+                auto startTime = chrono::steady_clock::now();
+                HopMatrix matrix = graph.computeHopMatrix(allAirports);
+                double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                
+                // Pembanding: BFS satu source per kali untuk 64 source tersebar, diekstrapolasi
+                size_t sample = min<size_t>(64, allAirports.size());
+                startTime = chrono::steady_clock::now();
+                for (size_t i = 0; i < sample; i++) {
+                    graph.traverseBFS(allAirports[i * allAirports.size() / sample]);
                 }
-                if (traversal.size() > 20) cout << " ...";
-                cout << endl;
+                double sampleSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+                double singleSeconds = sampleSeconds / max<size_t>(sample, 1) * allAirports.size();
+                
+                long long reachablePairs = 0;
+                for (long long count : matrix.histogram) {
+                    reachablePairs += count;
+                }
+                
+                cout << fixed << setprecision(2);
+                cout << "Matriks " << allAirports.size() << " x " << allAirports.size()
+                     << " selesai dalam " << seconds << " detik" << endl;
+                cout << "BFS satu per satu (estimasi): " << singleSeconds << " detik ("
+                     << singleSeconds / max(seconds, 1e-9) << "x lebih lambat)" << endl;
+                cout << "\n" << left << setw(8) << "STOPS" << setw(16) << "PASANGAN" << "PERSEN" << endl;
+                cout << string(34, '-') << endl;
+                for (size_t h = 1; h < matrix.histogram.size(); h++) {
+                    cout << left << setw(8) << h << setw(16) << matrix.histogram[h]
+                         << 100.0 * matrix.histogram[h] / max(reachablePairs, 1LL) << "%" << endl;
+                }
+                cout << string(34, '-') << endl;
+                cout << "Pasangan terhubung      : " << reachablePairs << endl;
+                cout << "Pasangan tidak terhubung: " << matrix.unreachablePairs << endl;
                 break;
             }
             
-            case 13: {  
+            case 24: {  // K-shortest paths (Yen)
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                string start;
-                cout << "Bandara awal: ";
+                string start, end, kStr;
+                cout << "Bandara asal: ";
                 getline(cin, start);
+                cout << "Bandara tujuan: ";
+                getline(cin, end);
+                cout << "Jumlah rute alternatif K [5]: ";
+                getline(cin, kStr);
                 
                 start = toUpperCase(trim(start));
-                if (start.empty()) {
+                end = toUpperCase(trim(end));
+                kStr = trim(kStr);
+                
+                if (start.empty() || end.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
-                if (!isValidAirportCode(start)) {
+                if (!isValidAirportCode(start) || !isValidAirportCode(end)) {
                     cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
                     break;
                 }
-                if (!graph.validateAirportInput(start, "Bandara")) break;
                 
-                vector<string> traversal = graph.traverse(start, "DFS");
-                cout << "\nDFS Traversal dari " << start << ":" << endl;
-                cout << "Bandara yang dapat dijangkau: " << traversal.size() << endl;
-                cout << "Urutan: ";
-                for (size_t i = 0; i < min(traversal.size(), size_t(20)); i++) {
-                    cout << traversal[i];
-                    if (i < min(traversal.size(), size_t(20)) - 1) cout << ", ";
+                int K = 5;
+                if (!kStr.empty()) {
+                    bool isNumeric = all_of(kStr.begin(), kStr.end(), ::isdigit);
+                    if (!isNumeric || kStr.length() > 3) {
+                        cout << "\n✗ K harus berupa angka (1-100)!" << endl;
+                        break;
+                    }
+                    K = stoi(kStr);
                 }
-                if (traversal.size() > 20) cout << " ...";
-                cout << endl;
+                if (K < 1 || K > 100) {
+                    cout << "\n✗ K harus antara 1-100!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
+                
+                auto startTime = chrono::steady_clock::now();
+                vector<PathResult> paths = graph.findKShortestPaths(start, end, K);
+                double millis = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+                
+                cout << "\n=== " << K << " RUTE TERPENDEK: " << start << " -> " << end << " ===" << endl;
+                if (paths.empty()) {
+                    cout << "Path tidak ditemukan!" << endl;
+                    break;
+                }
+                for (size_t i = 0; i < paths.size(); i++) {
+                    cout << "\n#" << (i + 1) << " - " << paths[i].totalDistance << " km, "
+                         << paths[i].stops << " stops" << endl;
+                    cout << "   ";
+                    for (size_t k = 0; k < paths[i].path.size(); k++) {
+                        cout << paths[i].path[k] << (k + 1 < paths[i].path.size() ? " -> " : "");
+                    }
+                    cout << endl;
+                }
+                cout << "\nDitemukan " << paths.size() << " rute dalam " << fixed << setprecision(2)
+                     << millis << " ms" << endl;
                 break;
             }
             
-            case 14: {  
+            case 25: {  // findAllPaths sekuensial vs paralel (work stealing)
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
                 string start, end, maxStopsStr;
-                int maxStops;
-                
                 cout << "Bandara asal: ";
                 getline(cin, start);
                 cout << "Bandara tujuan: ";
@@ -1626,7 +7755,7 @@ int main() {
                 end = toUpperCase(trim(end));
                 maxStopsStr = trim(maxStopsStr);
                 
-                if (start.empty() || end.empty()) {
+                if (start.empty() || end.empty() || maxStopsStr.empty()) {
                     cout << "\n✗ Input tidak boleh kosong!" << endl;
                     break;
                 }
@@ -1634,106 +7763,244 @@ int main() {
                     cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
                     break;
                 }
+                bool isNumeric = all_of(maxStopsStr.begin(), maxStopsStr.end(), ::isdigit);
+                if (!isNumeric || maxStopsStr.length() > 2) {
+                    cout << "\n✗ Maksimal stops harus berupa angka!" << endl;
+                    break;
+                }
+                int maxStops = stoi(maxStopsStr);
+                if (maxStops < 1 || maxStops > 10) {
+                    cout << "\n✗ Max stops harus antara 1-10!" << endl;
+                    break;
+                }
+                if (!graph.validateAirportInput(start, "Bandara asal")) break;
+                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
                 
-                // Validate maxStops input
-                if (maxStopsStr.empty()) {
-                    cout << "\n✗ Input maksimal stops tidak boleh kosong!" << endl;
+                const double TIME_BUDGET_MS = 30000;
+                auto countOnly = [](const vector<string>&) { return true; };
+                PathEnumerationStats sequential = graph.findAllPaths(start, end, maxStops, countOnly,
+                                                                     PathEnumerationLimits(0, TIME_BUDGET_MS));
+                PathEnumerationStats parallel = graph.findAllPathsParallel(start, end, maxStops, countOnly,
+                                                                           PathEnumerationLimits(0, TIME_BUDGET_MS));
+                
+                int threads = max(1u, thread::hardware_concurrency());
+                cout << "\n=== SEMUA PATH " << start << " -> " << end << " (max " << maxStops << " stops) ===" << endl;
+                cout << fixed << setprecision(2);
+                cout << "Sekuensial        : " << sequential.pathsFound << " path, " << sequential.millis << " ms" << endl;
+                cout << "Paralel (" << threads << " thread): " << parallel.pathsFound << " path, "
+                     << parallel.millis << " ms" << endl;
+                if (sequential.timedOut || parallel.timedOut) {
+                    cout << "⚠ Dihentikan setelah " << (int)(TIME_BUDGET_MS / 1000)
+                         << " detik, jumlah path belum lengkap" << endl;
+                } else if (parallel.millis > 0) {
+                    cout << "Speedup           : " << (sequential.millis / parallel.millis) << "x" << endl;
+                }
+                if (!sequential.timedOut && !parallel.timedOut) {
+                    graph.verifyPathEnumeration(start, end, maxStops, PathEnumerationLimits(0, TIME_BUDGET_MS));
+                }
+                break;
+            }
+            
+            case 26: {  // Benchmark policy priority queue Dijkstra
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
                 
-                // Check if maxStops is numeric
-                bool isNumeric = true;
-                for (char c : maxStopsStr) {
-                    if (!isdigit(c)) {
-                        isNumeric = false;
+                string pairsStr;
+                cout << "\n=== BENCHMARK PRIORITY QUEUE DIJKSTRA ===" << endl;
+                cout << "Jumlah pasangan acak [2000]: ";
+                getline(cin, pairsStr);
+                pairsStr = trim(pairsStr);
+                
+                int randomPairs = 2000;
+                if (!pairsStr.empty()) {
+                    bool isNumeric = all_of(pairsStr.begin(), pairsStr.end(), ::isdigit);
+                    if (!isNumeric || pairsStr.length() > 6) {
+                        cout << "\n✗ Jumlah pasangan harus berupa angka (1-100000)!" << endl;
                         break;
                     }
+                    randomPairs = stoi(pairsStr);
+                }
+                if (randomPairs < 1 || randomPairs > 100000) {
+                    cout << "\n✗ Jumlah pasangan harus antara 1-100000!" << endl;
+                    break;
                 }
                 
-                if (!isNumeric) {
-                    cout << "\n✗ Maksimal stops harus berupa angka!" << endl;
-                    cout << "💡 Contoh: 3, 5, 10" << endl;
+                graph.benchmarkPriorityQueues(randomPairs);
+                break;
+            }
+            
+            case 27: {  // Cache shortest-path tree hub
+                if (!dataLoaded) {
+                    cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
                 
-                // Convert to integer
-                try {
-                    maxStops = stoi(maxStopsStr);
-                } catch (...) {
-                    cout << "\n✗ Input tidak valid!" << endl;
+                string countStr;
+                cout << "\n=== CACHE SHORTEST-PATH TREE HUB ===" << endl;
+                cout << "Jumlah hub tersibuk [50] (0 = matikan cache): ";
+                getline(cin, countStr);
+                countStr = trim(countStr);
+                
+                int hubCount = 50;
+                if (!countStr.empty()) {
+                    bool isNumeric = all_of(countStr.begin(), countStr.end(), ::isdigit);
+                    if (!isNumeric || countStr.length() > 3) {
+                        cout << "\n✗ Jumlah hub harus berupa angka (0-500)!" << endl;
+                        break;
+                    }
+                    hubCount = stoi(countStr);
+                }
+                if (hubCount > 500) {
+                    cout << "\n✗ Jumlah hub harus antara 0-500!" << endl;
                     break;
                 }
                 
-                if (maxStops < 1 || maxStops > 10) {
-                    cout << "\n✗ Max stops harus antara 1-10!" << endl;
+                vector<string> hubs = graph.busiestAirports(hubCount);
+                graph.setHubAirports(hubs);
+                if (hubs.empty()) {
+                    cout << "✓ Cache hub dimatikan" << endl;
                     break;
                 }
-                if (!graph.validateAirportInput(start, "Bandara asal")) break;
-                if (!graph.validateAirportInput(end, "Bandara tujuan")) break;
+                graph.buildHubTrees();
+                cout << "Hub: ";
+                for (size_t i = 0; i < min(hubs.size(), size_t(10)); i++) {
+                    cout << hubs[i] << (i + 1 < min(hubs.size(), size_t(10)) ? ", " : "");
+                }
+                if (hubs.size() > 10) {
+                    cout << ", ... (+" << (hubs.size() - 10) << ")";
+                }
+                cout << endl;
                 
-                vector<vector<string>> allPaths = graph.findAllPaths(start, end, maxStops);
-                cout << "\nDitemukan " << allPaths.size() << " path:" << endl;
-                for (size_t i = 0; i < min(allPaths.size(), size_t(10)); i++) {
-                    cout << (i + 1) << ". ";
-                    graph.displayPath(allPaths[i]);
+                // Query dari/ke hub: tree cache vs Dijkstra penuh
+                vector<pair<AirportId, AirportId>> hubQueries;
+                for (const auto& pair : graph.randomAirportPairs(2000, 99)) {
+                    AirportId hub = AirportId::fromCode(hubs[hubQueries.size() % hubs.size()]);
+                    hubQueries.push_back(hubQueries.size() % 2 == 0 ? make_pair(hub, pair.second)
+                                                                    : make_pair(pair.first, hub));
                 }
-                if (allPaths.size() > 10) {
-                    cout << "... dan " << (allPaths.size() - 10) << " path lainnya" << endl;
+                
+                SearchWorkspace workspace;
+                int mismatches = 0;
+                double cachedMicros = 0, dijkstraMicros = 0;
+                for (const auto& query : hubQueries) {
+                    auto startTime = chrono::steady_clock::now();
+                    PathResult cached = graph.findShortestPath(query.first, query.second);
+                    auto midTime = chrono::steady_clock::now();
+                    PathResult full = graph.findShortestPath(query.first, query.second, workspace, workspace.heapForward);
+                    auto endTime = chrono::steady_clock::now();
+                    
+                    cachedMicros += chrono::duration<double, micro>(midTime - startTime).count();
+                    dijkstraMicros += chrono::duration<double, micro>(endTime - midTime).count();
+                    if (cached.found != full.found || cached.totalDistance != full.totalDistance) {
+                        mismatches++;
+                    }
                 }
+                cout << fixed << setprecision(2);
+                cout << "Query dari/ke hub: " << (cachedMicros / hubQueries.size()) << " us (tree) vs "
+                     << (dijkstraMicros / hubQueries.size()) << " us (Dijkstra), "
+                     << mismatches << " jarak berbeda dari " << hubQueries.size() << " query" << endl;
                 break;
             }
             
-            case 15: {  
+            case 28: {  // Cache LRU hasil query
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
-                graph.displayStatistics();
+                
+                string capacityStr;
+                cout << "\n=== CACHE HASIL QUERY (LRU) ===" << endl;
+                cout << "Kapasitas entry [10000] (0 = matikan cache): ";
+                getline(cin, capacityStr);
+                capacityStr = trim(capacityStr);
+                
+                int capacity = 10000;
+                if (!capacityStr.empty()) {
+                    bool isNumeric = all_of(capacityStr.begin(), capacityStr.end(), ::isdigit);
+                    if (!isNumeric || capacityStr.length() > 7) {
+                        cout << "\n✗ Kapasitas harus berupa angka (0-1000000)!" << endl;
+                        break;
+                    }
+                    capacity = stoi(capacityStr);
+                }
+                if (capacity > 1000000) {
+                    cout << "\n✗ Kapasitas harus antara 0-1000000!" << endl;
+                    break;
+                }
+                
+                graph.setResultCacheCapacity(capacity);
+                if (capacity == 0) {
+                    graph.clearResultCache();
+                    cout << "✓ Cache hasil query dimatikan" << endl;
+                    break;
+                }
+                
+                // Workload miring: 80% query ke 1% pasangan terpopuler (200 dari 20000)
+                vector<pair<AirportId, AirportId>> pairPool = graph.randomAirportPairs(20000, 77);
+                mt19937 rng(2024);
+                vector<pair<AirportId, AirportId>> workload;
+                for (int i = 0; i < 20000; i++) {
+                    size_t pick = (rng() % 100 < 80) ? rng() % 200 : rng() % pairPool.size();
+                    workload.push_back(pairPool[pick]);
+                }
+                
+                QueryCacheStats before = graph.getResultCacheStats();
+                SearchWorkspace workspace;
+                auto startTime = chrono::steady_clock::now();
+                for (const auto& query : workload) {
+                    graph.findShortestPath(query.first, query.second);
+                }
+                auto midTime = chrono::steady_clock::now();
+                for (const auto& query : workload) {
+                    graph.findShortestPath(query.first, query.second, workspace, workspace.heapForward);
+                }
+                auto endTime = chrono::steady_clock::now();
+                
+                QueryCacheStats stats = graph.getResultCacheStats();
+                uint64_t hits = stats.hits - before.hits;
+                uint64_t misses = stats.misses - before.misses;
+                cout << fixed << setprecision(2);
+                cout << "Workload 20000 query (80% ke 200 pasangan populer):" << endl;
+                cout << "  Dengan cache : " << chrono::duration<double, milli>(midTime - startTime).count() << " ms"
+                     << " (hit " << hits << ", miss " << misses << ", hit rate "
+                     << (100.0 * hits / max<uint64_t>(1, hits + misses)) << "%)" << endl;
+                cout << "  Tanpa cache  : " << chrono::duration<double, milli>(endTime - midTime).count() << " ms" << endl;
+                cout << "Total cache: " << stats.size << "/" << stats.capacity << " entry, "
+                     << stats.hits << " hit, " << stats.misses << " miss, " << stats.evictions << " eviction, "
+                     << stats.invalidations << " invalidasi (versi graph " << graph.getGraphVersion() << ")" << endl;
+                graph.verifyResultCache(500);
                 break;
             }
             
-            case 16: {  // removeEdge
+            case 29: {  // Snapshot MVCC
                 if (!dataLoaded) {
                     cout << "\n✗ Silakan load data terlebih dahulu!" << endl;
                     break;
                 }
                 
-                string from, to;
-                cout << "\n=== HAPUS RUTE ===" << endl;
-                cout << "Bandara asal: ";
-                getline(cin, from);
-                cout << "Bandara tujuan: ";
-                getline(cin, to);
-                
-                from = toUpperCase(trim(from));
-                to = toUpperCase(trim(to));
+                string threadStr;
+                cout << "\n=== SNAPSHOT MVCC (COPY-ON-WRITE) ===" << endl;
+                cout << "Jumlah thread reader [4]: ";
+                getline(cin, threadStr);
+                threadStr = trim(threadStr);
                 
-                if (from.empty() || to.empty()) {
-                    cout << "\n✗ Input tidak boleh kosong!" << endl;
-                    break;
+                int readerThreads = 4;
+                if (!threadStr.empty()) {
+                    bool isNumeric = all_of(threadStr.begin(), threadStr.end(), ::isdigit);
+                    if (!isNumeric || threadStr.length() > 2) {
+                        cout << "\n✗ Jumlah thread harus berupa angka (1-64)!" << endl;
+                        break;
+                    }
+                    readerThreads = stoi(threadStr);
                 }
-                if (!isValidAirportCode(from) || !isValidAirportCode(to)) {
-                    cout << "\n✗ Kode bandara harus 3 huruf!" << endl;
+                if (readerThreads < 1 || readerThreads > 64) {
+                    cout << "\n✗ Jumlah thread harus antara 1-64!" << endl;
                     break;
                 }
                 
-                // Show existing routes before removal
-                if (graph.hasEdge(from, to)) {
-                    vector<Route> routes = graph.getNeighbors(from);
-                    int count = 0;
-                    for (const Route& r : routes) {
-                        if (r.destination == to) count++;
-                    }
-                    cout << "\nDitemukan " << count << " rute dari " << from << " → " << to << endl;
-                }
-                
-                bool success = graph.removeEdge(from, to);
-                if (success) {
-                    cout << "\n✓ Rute " << from << " → " << to << " berhasil dihapus!" << endl;
-                    cout << "💡 Note: Semua rute dengan airlines berbeda juga terhapus." << endl;
-                } else {
-                    cout << "\n✗ Gagal menghapus rute." << endl;
-                }
+                graph.benchmarkSnapshotUpdates(readerThreads);
                 break;
             }
             